@@ -0,0 +1,10 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameModes/SpyItemPreloadManifest.h"
+
+const FSpyItemPreloadMapEntry* USpyItemPreloadManifest::FindMapEntry(const FName InMapPackageName) const
+{
+	return MapItemManifests.FindByPredicate([InMapPackageName](const FSpyItemPreloadMapEntry& MapEntry)
+		{ return MapEntry.MapPackageName == InMapPackageName; });
+}
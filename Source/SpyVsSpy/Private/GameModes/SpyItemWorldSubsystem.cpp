@@ -6,25 +6,87 @@
 #include "SVSLogger.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
+#include "GameModes/SpyItemPreloadManifest.h"
 #include "Items/InventoryBaseAsset.h"
 #include "Items/InventoryComponent.h"
 #include "Rooms/FurnitureInteractionComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameModes/SpyVsSpyGameState.h"
 #include "Players/SpyCharacter.h"
+#include "Players/SpyPlayerState.h"
+#include "Rooms/RoomManager.h"
+#include "Rooms/SVSRoom.h"
 #include "Rooms/SpyFurniture.h"
 
+const FName USpyItemWorldSubsystem::GameplayAssetBundle = FName("Gameplay");
+const FName USpyItemWorldSubsystem::CosmeticAssetBundle = FName("Cosmetic");
+
+void USpyItemWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	/** Dedicated servers have nothing to render or play so only load what gameplay needs */
+	ItemAssetBundles.Reset();
+	ItemAssetBundles.Emplace(GameplayAssetBundle);
+	if (!IsRunningDedicatedServer())
+	{ ItemAssetBundles.Emplace(CosmeticAssetBundle); }
+
+	/** The asset manager outlives worlds so loading can start while the map is still being set up */
+	AssetManager = UAssetManager::GetIfValid();
+	if (IsValid(AssetManager) && GetWorld()->IsGameWorld())
+	{ LoadManifestItemAssets(); }
+}
+
 void USpyItemWorldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 {
 	Super::OnWorldBeginPlay(InWorld);
 
 	/** Setup manager references */
-	AssetManager = UAssetManager::GetIfValid();
+	if (!IsValid(AssetManager))
+	{ AssetManager = UAssetManager::GetIfValid(); }
 	checkf(IsValid(AssetManager), TEXT("ItemSubsystem could not find a valid Asset Manager"));
 }
 
+void USpyItemWorldSubsystem::LoadManifestItemAssets()
+{
+	const FName MapPackageName = FName(UWorld::RemovePIEPrefix(GetWorld()->GetOutermost()->GetName()));
+	const FSpyItemPreloadMapEntry* MapEntry = GetDefault<USpyItemPreloadManifest>()->FindMapEntry(MapPackageName);
+	if (!MapEntry)
+	{ return; }
+
+	/** Requests are made per type, matching the map's own LoadSpyItemAssets calls which then find them in flight */
+	TMap<FPrimaryAssetType, TArray<FPrimaryAssetId>> ItemAssetIdsByType;
+	for (const FPrimaryAssetId& ItemAssetId : MapEntry->ItemAssetIds)
+	{ ItemAssetIdsByType.FindOrAdd(ItemAssetId.PrimaryAssetType).Emplace(ItemAssetId); }
+	
+	for (const TPair<FPrimaryAssetType, TArray<FPrimaryAssetId>>& ItemAssetIdsOfType : ItemAssetIdsByType)
+	{ LoadSpyItemAssets(ItemAssetIdsOfType.Value, ItemAssetIdsOfType.Key); }
+
+	UE_LOG(SVSLogDebug, Log, TEXT("SpyItemSubsystem preloading %i items of %i types from the manifest for map: %s"),
+		MapEntry->ItemAssetIds.Num(),
+		ItemAssetIdsByType.Num(),
+		*MapPackageName.ToString());
+}
+
 void USpyItemWorldSubsystem::Deinitialize()
 {
-	// TODO clear state AND / OR clear assets from asset manager
+	// TODO clear assets from asset manager
+	if (AllItemAssetsLoadHandle.IsValid())
+	{ AllItemAssetsLoadHandle->CancelHandle(); }
+	AllItemAssetsLoadHandle.Reset();
+	for (TPair<FPrimaryAssetType, FSpyItemAssetType>& ItemAssetTypeRequested : ItemAssetTypesRequested)
+	{
+		if (ItemAssetTypeRequested.Value.LoadHandle.IsValid())
+		{ ItemAssetTypeRequested.Value.LoadHandle->CancelHandle(); }
+	}
+	ItemAssetTypesRequested.Empty();
+	ItemHandleRegistry.Empty();
+	ItemHandlesByAssetId.Empty();
+	bItemHandleRegistryFrozen = false;
+	ItemHandleRegistryChecksum = 0;
+	bAllItemAssetsLoaded = false;
+	OnAllItemAssetsLoaded.Clear();
+	
 	Super::Deinitialize();
 }
 
@@ -33,60 +95,272 @@ void USpyItemWorldSubsystem::LoadSpyItemAssets(const TArray<FPrimaryAssetId>& In
 	if (InItemAssetIdContainer.Num() < 1 && !InAssetType.IsValid())
 	{ return; }
 	
-	/** Update Associated Map so that we can do verification later on */
-	if (!TotalAssetsRequestedToLoadPerTypeMap.Contains(InAssetType))
+	/** Each type is requested once, keep the entry so that we can do verification later on */
+	TSharedPtr<FStreamableHandle> PreviousLoadHandle;
+	FSpyItemAssetType* ItemAssetTypeRequested = ItemAssetTypesRequested.Find(InAssetType);
+	if (ItemAssetTypeRequested)
 	{
-		bAllItemAssetsLoaded = false;
-		TotalAssetsRequestedToLoadPerTypeMap.Add(InAssetType, InItemAssetIdContainer.Num());
-		TotalItemsRequested += InItemAssetIdContainer.Num();
+		/** The preload manifest already requested this type, re-issue the request with any ids it was missing */
+		int32 NumMissingItemAssetIds = 0;
+		for (const FPrimaryAssetId& ItemAssetId : InItemAssetIdContainer)
+		{
+			if (ItemAssetTypeRequested->ItemAssetIds.Contains(ItemAssetId))
+			{ continue; }
+			ItemAssetTypeRequested->ItemAssetIds.Emplace(ItemAssetId);
+			NumMissingItemAssetIds++;
+		}
+		if (NumMissingItemAssetIds == 0)
+		{ return; }
+
+		UE_LOG(SVSLog, Warning, TEXT("SpyItemSubsystem item preload manifest is missing %i items of type: %s, rerun the SpyItemPreloadManifest commandlet"),
+			NumMissingItemAssetIds,
+			*InAssetType.ToString());
+		PreviousLoadHandle = ItemAssetTypeRequested->LoadHandle;
+		ItemAssetTypeRequested->LoadStartTime = FPlatformTime::Seconds();
+		ItemAssetTypeRequested->LoadDuration = -1.0;
 	}
 	else
+	{
+		ItemAssetTypeRequested = &ItemAssetTypesRequested.Add(InAssetType);
+		ItemAssetTypeRequested->ItemAssetType = InAssetType;
+		ItemAssetTypeRequested->ItemAssetIds = InItemAssetIdContainer;
+		ItemAssetTypeRequested->LoadStartTime = FPlatformTime::Seconds();
+	}
+
+	bAllItemAssetsLoaded = false;
+	ItemAssetTypeRequested->ItemAssetsOfTypeTotal = ItemAssetTypeRequested->ItemAssetIds.Num();
+
+	/** One batched request per type, the delegate runs a frame later even when everything is already in memory */
+	ItemAssetTypeRequested->LoadHandle = AssetManager->LoadPrimaryAssets(
+		ItemAssetTypeRequested->ItemAssetIds,
+		ItemAssetBundles,
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnItemAssetTypeLoaded, InAssetType));
+
+	/** Cancel the superseded request after the new one holds its assets so nothing already loaded is released */
+	if (PreviousLoadHandle.IsValid())
+	{ PreviousLoadHandle->CancelHandle(); }
+
+	UpdateAllItemAssetsLoadHandle();
+}
+
+void USpyItemWorldSubsystem::OnItemAssetTypeLoaded(const FPrimaryAssetType InAssetType)
+{
+	FSpyItemAssetType* ItemAssetTypeRequested = ItemAssetTypesRequested.Find(InAssetType);
+	if (!ItemAssetTypeRequested)
 	{ return; }
+
+	ItemAssetTypeRequested->LoadDuration = FPlatformTime::Seconds() - ItemAssetTypeRequested->LoadStartTime;
+
+	/** Populate the registry once so distribution and verification never query the asset manager again */
+	ItemAssetTypeRequested->LoadedItemAssets.Reset(ItemAssetTypeRequested->ItemAssetIds.Num());
+	ItemAssetTypeRequested->LoadedItemAssetIds.Reset(ItemAssetTypeRequested->ItemAssetIds.Num());
+	for (const FPrimaryAssetId& ItemAssetId : ItemAssetTypeRequested->ItemAssetIds)
+	{
+		UInventoryBaseAsset* InventoryAsset = Cast<UInventoryBaseAsset>(AssetManager->GetPrimaryAssetObject(ItemAssetId));
+		if (!IsValid(InventoryAsset) || ItemAssetTypeRequested->LoadedItemAssetIds.Contains(ItemAssetId))
+		{ continue; }
+		
+		ItemAssetTypeRequested->LoadedItemAssets.Emplace(InventoryAsset);
+		ItemAssetTypeRequested->LoadedItemAssetIds.Emplace(ItemAssetId);
+	}
+	UE_LOG(SVSLogDebug, Log, TEXT("SpyItemSubsystem loaded %i assets of type: %s with bundles: %s in %f seconds"),
+		ItemAssetTypeRequested->ItemAssetsOfTypeTotal,
+		*InAssetType.ToString(),
+		*FString::JoinBy(ItemAssetBundles, TEXT(","), [](const FName& Bundle) { return Bundle.ToString(); }),
+		ItemAssetTypeRequested->LoadDuration);
+
+	/** Verify once every requested type has filled its registry, types loading in parallel finish in any order */
+	for (const TPair<FPrimaryAssetType, FSpyItemAssetType>& ItemAssetTypeLoading : ItemAssetTypesRequested)
+	{
+		if (ItemAssetTypeLoading.Value.LoadDuration < 0.0)
+		{ return; }
+	}
+	OnAllItemAssetTypesLoaded();
+}
+
+void USpyItemWorldSubsystem::UpdateAllItemAssetsLoadHandle()
+{
+	TArray<TSharedPtr<FStreamableHandle>> ItemAssetTypeLoadHandles;
+	for (const TPair<FPrimaryAssetType, FSpyItemAssetType>& ItemAssetTypeRequested : ItemAssetTypesRequested)
+	{
+		if (ItemAssetTypeRequested.Value.LoadHandle.IsValid())
+		{ ItemAssetTypeLoadHandles.Emplace(ItemAssetTypeRequested.Value.LoadHandle); }
+	}
+
+	/** Only reports progress, completion is driven by the per type delegates which fill the registries */
+	AllItemAssetsLoadHandle.Reset();
 	
-	/** Request load of items */
-	// todo add switch for fireonlyonce, perhaps set this func to a bool type
-	TotalObjectsRequestedForLoad = InItemAssetIdContainer.Num();
-	for (FPrimaryAssetId AssetID : InItemAssetIdContainer)
-	{ LoadItemAssetFromAssetId(AssetID, InAssetType); }
+	if (ItemAssetTypeLoadHandles.Num() > 0)
+	{
+		AllItemAssetsLoadHandle = AssetManager->GetStreamableManager().CreateCombinedHandle(
+			ItemAssetTypeLoadHandles,
+			TEXT("SpyItemAssets"));
+	}
 }
 
-void USpyItemWorldSubsystem::LoadItemAssetFromAssetId(const FPrimaryAssetId& InItemAssetId, const FPrimaryAssetType& InAssetType)
+void USpyItemWorldSubsystem::OnAllItemAssetTypesLoaded()
 {
-	if (!InItemAssetId.IsValid() || !InAssetType.IsValid())
-	{ return; }
+	TryVerifyAllItemAssetsLoaded();
+	if (bAllItemAssetsLoaded)
+	{
+		BuildItemHandleRegistry();
+		OnAllItemAssetsLoaded.Broadcast();
+	}
+}
+
+void USpyItemWorldSubsystem::BuildItemHandleRegistry()
+{
+	/** Items loaded after the registry was built have no handle rather than shifting handles already in use */
+	if (bItemHandleRegistryFrozen)
+	{
+		for (const TPair<FPrimaryAssetType, FSpyItemAssetType>& ItemAssetTypeRequested : ItemAssetTypesRequested)
+		{
+			for (const FPrimaryAssetId& LoadedItemAssetId : ItemAssetTypeRequested.Value.LoadedItemAssetIds)
+			{
+				if (!ItemHandlesByAssetId.Contains(LoadedItemAssetId))
+				{
+					UE_LOG(SVSLog, Warning, TEXT("SpyItemSubsystem item: %s loaded after handles were assigned and cannot be held in inventories, add it to the preload manifest"),
+						*LoadedItemAssetId.ToString());
+				}
+			}
+		}
+		return;
+	}
 	
-	/** Asset Categories to load, use empty array to get all of them */
-	TArray<FName> CategoryBundles;
+	TArray<TPair<FPrimaryAssetId, UInventoryBaseAsset*>> SortedItemAssets;
+	for (const TPair<FPrimaryAssetType, FSpyItemAssetType>& ItemAssetTypeRequested : ItemAssetTypesRequested)
+	{
+		const FSpyItemAssetType& ItemAssetType = ItemAssetTypeRequested.Value;
+		for (int32 ItemIndex = 0; ItemIndex < ItemAssetType.LoadedItemAssets.Num(); ItemIndex++)
+		{ SortedItemAssets.Emplace(ItemAssetType.LoadedItemAssetIds[ItemIndex], ItemAssetType.LoadedItemAssets[ItemIndex]); }
+	}
+	SortedItemAssets.Sort([](const TPair<FPrimaryAssetId, UInventoryBaseAsset*>& A, const TPair<FPrimaryAssetId, UInventoryBaseAsset*>& B)
+		{ return A.Key.ToString() < B.Key.ToString(); });
 
-	/** Async Load Delegate */
-	const FStreamableDelegate AssetAsyncLoadDelegate = FStreamableDelegate::CreateUObject(
-		this,
-		&ThisClass::OnItemAssetLoadFromAssetId,
-		InItemAssetId);
+	if (SortedItemAssets.Num() > InvalidItemHandle)
+	{
+		UE_LOG(SVSLog, Warning, TEXT("SpyItemSubsystem has %i items but only %i handles, remaining items cannot be held in inventories"),
+			SortedItemAssets.Num(),
+			InvalidItemHandle);
+		SortedItemAssets.SetNum(InvalidItemHandle);
+	}
+
+	ItemHandleRegistry.Reset(SortedItemAssets.Num());
+	ItemHandlesByAssetId.Reset();
+	ItemHandleRegistryChecksum = 0;
+	for (const TPair<FPrimaryAssetId, UInventoryBaseAsset*>& SortedItemAsset : SortedItemAssets)
+	{
+		const uint8 ItemHandle = ItemHandleRegistry.Emplace(SortedItemAsset.Value);
+		
+		/** Inventories list items by the asset's own Primary Asset Id which may differ from the requested one */
+		ItemHandlesByAssetId.Emplace(SortedItemAsset.Key, ItemHandle);
+		ItemHandlesByAssetId.Emplace(SortedItemAsset.Value->GetPrimaryAssetId(), ItemHandle);
+		ItemHandleRegistryChecksum = FCrc::StrCrc32(*SortedItemAsset.Key.ToString(), ItemHandleRegistryChecksum);
+	}
+}
+
+void USpyItemWorldSubsystem::FreezeItemHandleRegistry()
+{
+	/** Nothing to freeze until the first types have loaded */
+	if (bItemHandleRegistryFrozen || ItemHandleRegistry.Num() == 0)
+	{ return; }
+	bItemHandleRegistryFrozen = true;
 
-	/** Load asset with async load delegate */
-	AssetManager->LoadPrimaryAsset(InItemAssetId, CategoryBundles, AssetAsyncLoadDelegate);
+	/** Server publishes its checksum, a game state which is not up yet pulls it on begin play */
+	ASpyVsSpyGameState* SpyGameState = GetWorld()->GetGameState<ASpyVsSpyGameState>();
+	if (GetWorld()->GetNetMode() != NM_Client)
+	{
+		if (IsValid(SpyGameState))
+		{ SpyGameState->SetItemHandleRegistryChecksum(ItemHandleRegistryChecksum); }
+	}
+	else
+	{ VerifyItemHandleRegistryChecksum(); }
 }
 
-void USpyItemWorldSubsystem::OnItemAssetLoadFromAssetId(const FPrimaryAssetId InItemAssetId)
+void USpyItemWorldSubsystem::VerifyItemHandleRegistryChecksum() const
 {
-	UInventoryBaseAsset* InventoryAsset = Cast<UInventoryBaseAsset>(AssetManager->GetPrimaryAssetObject(InItemAssetId));
-	if (!IsValid(InventoryAsset))
+	const ASpyVsSpyGameState* SpyGameState = GetWorld()->GetGameState<ASpyVsSpyGameState>();
+	if (GetWorld()->GetNetMode() != NM_Client ||
+		!bItemHandleRegistryFrozen ||
+		!IsValid(SpyGameState) ||
+		SpyGameState->GetItemHandleRegistryChecksum() == 0)
 	{ return; }
 
-	// TODO remove
-	/** Update Item's ItemID based upon location in registry array.  Assumes asset manager will not create dupes */
-	// const uint8 RegistryIndex = ItemRegistry.AddUnique(InventoryAsset);
-	// InventoryAsset->ItemID = RegistryIndex;
+	if (SpyGameState->GetItemHandleRegistryChecksum() != ItemHandleRegistryChecksum)
+	{
+		UE_LOG(SVSLog, Error, TEXT("SpyItemSubsystem item handles do not match the server, client loaded %i items: %s"),
+			ItemHandleRegistry.Num(),
+			*FString::JoinBy(ItemHandleRegistry, TEXT(","), [](const UInventoryBaseAsset* ItemAsset)
+				{ return IsValid(ItemAsset) ? ItemAsset->GetPrimaryAssetId().ToString() : FString(); }));
+	}
+}
+
+uint8 USpyItemWorldSubsystem::GetItemHandle(const FPrimaryAssetId& InItemAssetId)
+{
+	FreezeItemHandleRegistry();
+	
+	const uint8* ItemHandle = ItemHandlesByAssetId.Find(InItemAssetId);
+	return ItemHandle ? *ItemHandle : InvalidItemHandle;
+}
+
+UInventoryBaseAsset* USpyItemWorldSubsystem::GetItemAssetByHandle(const uint8 InItemHandle)
+{
+	FreezeItemHandleRegistry();
 	
-	TotalItemsRequestedAndLoaded++;
-	if (TotalItemsRequestedAndLoaded == TotalItemsRequested)
-	{ TryVerifyAllItemAssetsLoaded(); }
+	return ItemHandleRegistry.IsValidIndex(InItemHandle) ? ItemHandleRegistry[InItemHandle] : nullptr;
+}
+
+const TArray<UInventoryBaseAsset*>& USpyItemWorldSubsystem::GetLoadedItemAssets(const FPrimaryAssetType& InAssetType) const
+{
+	static const TArray<UInventoryBaseAsset*> EmptyItemAssets;
+	const FSpyItemAssetType* ItemAssetTypeRequested = ItemAssetTypesRequested.Find(InAssetType);
+	return ItemAssetTypeRequested ? ItemAssetTypeRequested->LoadedItemAssets : EmptyItemAssets;
+}
+
+const TArray<FPrimaryAssetId>& USpyItemWorldSubsystem::GetLoadedItemAssetIds(const FPrimaryAssetType& InAssetType) const
+{
+	static const TArray<FPrimaryAssetId> EmptyItemAssetIds;
+	const FSpyItemAssetType* ItemAssetTypeRequested = ItemAssetTypesRequested.Find(InAssetType);
+	return ItemAssetTypeRequested ? ItemAssetTypeRequested->LoadedItemAssetIds : EmptyItemAssetIds;
+}
+
+void USpyItemWorldSubsystem::RegisterSpyCharacter(ASpyCharacter* InSpyCharacter)
+{
+	if (IsValid(InSpyCharacter))
+	{ SpyCharacterCollection.AddUnique(InSpyCharacter); }
+}
+
+void USpyItemWorldSubsystem::UnregisterSpyCharacter(ASpyCharacter* InSpyCharacter)
+{
+	SpyCharacterCollection.RemoveSingleSwap(InSpyCharacter);
+}
+
+void USpyItemWorldSubsystem::RegisterSpyFurniture(ASpyFurniture* InSpyFurniture)
+{
+	if (IsValid(InSpyFurniture))
+	{ SpyFurnitureCollection.AddUnique(InSpyFurniture); }
+}
+
+void USpyItemWorldSubsystem::UnregisterSpyFurniture(ASpyFurniture* InSpyFurniture)
+{
+	SpyFurnitureCollection.RemoveSingleSwap(InSpyFurniture);
+}
+
+float USpyItemWorldSubsystem::GetItemAssetTypeLoadProgress(const FPrimaryAssetType InAssetType) const
+{
+	const FSpyItemAssetType* ItemAssetTypeRequested = ItemAssetTypesRequested.Find(InAssetType);
+	if (!ItemAssetTypeRequested)
+	{ return 0.0f; }
+
+	return ItemAssetTypeRequested->LoadHandle.IsValid() ? ItemAssetTypeRequested->LoadHandle->GetProgress() : 1.0f;
+}
+
+float USpyItemWorldSubsystem::GetAllItemAssetsLoadProgress() const
+{
+	if (ItemAssetTypesRequested.Num() == 0)
+	{ return 0.0f; }
 	
-	UE_LOG(SVSLogDebug, Log, TEXT(
-		"Asset manager on assetload check totalitemsrequestedandloaded: %i and totalitemsrequested: %i"),
-			TotalItemsRequestedAndLoaded,
-			TotalItemsRequested);
+	return AllItemAssetsLoadHandle.IsValid() ? AllItemAssetsLoadHandle->GetProgress() : 1.0f;
 }
 
 void USpyItemWorldSubsystem::TryVerifyAllItemAssetsLoaded()
@@ -94,35 +368,33 @@ void USpyItemWorldSubsystem::TryVerifyAllItemAssetsLoaded()
 	/** Success Count per FoundAssetType, incremented if successful */
 	int PerFoundAssetTypeCountCheckSuccessTotal = 0;
 	
-	TArray<FPrimaryAssetType> FoundAssetTypesToCheck;
-	TotalAssetsRequestedToLoadPerTypeMap.GetKeys(FoundAssetTypesToCheck);
-	for (FPrimaryAssetType FoundAssetType : FoundAssetTypesToCheck)
+	for (const TPair<FPrimaryAssetType, FSpyItemAssetType>& ItemAssetTypeRequested : ItemAssetTypesRequested)
 	{
-		TArray<UObject*> AssetManagerObjectList;
-		AssetManager->GetPrimaryAssetObjectList(FoundAssetType, AssetManagerObjectList);
+		const FPrimaryAssetType FoundAssetType = ItemAssetTypeRequested.Key;
+		const TArray<UInventoryBaseAsset*>& LoadedItemAssets = ItemAssetTypeRequested.Value.LoadedItemAssets;
 
-		const int32 ExpectedCount = *TotalAssetsRequestedToLoadPerTypeMap.Find(FoundAssetType);
-		if (AssetManagerObjectList.Num() == ExpectedCount)
+		const int32 ExpectedCount = ItemAssetTypeRequested.Value.ItemAssetsOfTypeTotal;
+		if (LoadedItemAssets.Num() == ExpectedCount)
 		{ PerFoundAssetTypeCountCheckSuccessTotal++; }
 
-		for (const UObject* ManagerObjectListItem : AssetManagerObjectList)
+		for (const UInventoryBaseAsset* LoadedItemAsset : LoadedItemAssets)
 		{
-			UE_LOG(SVSLogDebug, Log, TEXT("Asset manager has object: %s of class: %s with expected type: %s"),
-				*ManagerObjectListItem->GetName(),
-				*ManagerObjectListItem->GetClass()->GetName(),
+			UE_LOG(SVSLogDebug, Log, TEXT("Item registry has object: %s of class: %s with expected type: %s"),
+				*LoadedItemAsset->GetName(),
+				*LoadedItemAsset->GetClass()->GetName(),
 				*FoundAssetType.ToString());
 		}
 	}
 	
-	if (TotalAssetsRequestedToLoadPerTypeMap.Num() != PerFoundAssetTypeCountCheckSuccessTotal)
+	if (ItemAssetTypesRequested.Num() != PerFoundAssetTypeCountCheckSuccessTotal)
 	{
 		UE_LOG(SVSLogDebug, Log, TEXT(
 			"SpyItemSubsystem could not get a consistent counter between AssetsToLoad: %i and AssetsLoaded %i"),
-			TotalAssetsRequestedToLoadPerTypeMap.Num(),
+			ItemAssetTypesRequested.Num(),
 			PerFoundAssetTypeCountCheckSuccessTotal);
 	}
 
-	bAllItemAssetsLoaded = (TotalAssetsRequestedToLoadPerTypeMap.Num() == PerFoundAssetTypeCountCheckSuccessTotal);
+	bAllItemAssetsLoaded = (ItemAssetTypesRequested.Num() == PerFoundAssetTypeCountCheckSuccessTotal);
 }
 
 void USpyItemWorldSubsystem::DistributeItems(const FPrimaryAssetType& ItemToDistributeAssetType, const TSubclassOf<AActor> TargetActorClass)
@@ -137,32 +409,15 @@ void USpyItemWorldSubsystem::DistributeItems(const FPrimaryAssetType& ItemToDist
 	// TODO refactor this with proper usage of tsubclassof
 	if (TargetActorClass == ASpyCharacter::StaticClass())
 	{
-		TArray<AActor*> WorldActors;
-		UGameplayStatics::GetAllActorsOfClass(
-			GetWorld(),
-			ASpyCharacter::StaticClass(),
-			WorldActors);
-		TArray<UObject*> AssetManagerObjectList;
-		AssetManager->GetPrimaryAssetObjectList(ItemToDistributeAssetType, AssetManagerObjectList);
-
-		/** convert object types and get primary asset ids */
-		TArray<FPrimaryAssetId> InventoryBaseAssetPrimaryAssetIdCollection;
-		for (UObject* AssetManagerObject : AssetManagerObjectList)
-		{
-			if (const UInventoryBaseAsset* AssetToAdd = Cast<UInventoryBaseAsset>(AssetManagerObject))
-			{
-				InventoryBaseAssetPrimaryAssetIdCollection.AddUnique(
-					AssetToAdd->GetPrimaryAssetId());
-			}
-		}
+		const TArray<FPrimaryAssetId>& InventoryBaseAssetPrimaryAssetIdCollection = GetLoadedItemAssetIds(ItemToDistributeAssetType);
 
 		UE_LOG(SVSLogDebug, Log, TEXT("SpyItemSubsystem distribute items found %i actors and %i items"),
-			WorldActors.Num(),
+			SpyCharacterCollection.Num(),
 			InventoryBaseAssetPrimaryAssetIdCollection.Num());
 		
-		for (AActor* WorldActor : WorldActors)
+		for (const ASpyCharacter* SpyCharacter : SpyCharacterCollection)
 		{
-			if (const ASpyCharacter* SpyCharacter = Cast<ASpyCharacter>(WorldActor))
+			if (IsValid(SpyCharacter))
 			{
 				SpyCharacter->GetPlayerInventoryComponent()->SetPrimaryAssetIdsToLoad(
 					InventoryBaseAssetPrimaryAssetIdCollection);
@@ -176,39 +431,164 @@ void USpyItemWorldSubsystem::DistributeItems(const FPrimaryAssetType& ItemToDist
 		}
 	}
 	else if (TargetActorClass == ASpyFurniture::StaticClass())
+	{ DistributeItemsToFurniture(GetLoadedItemAssetIds(ItemToDistributeAssetType)); }
+}
+
+void USpyItemWorldSubsystem::SetItemDistributionSettings(const FSpyItemDistributionSettings& InItemDistributionSettings)
+{
+	ItemDistributionSettings = InItemDistributionSettings;
+	if (ItemDistributionSettings.Seed == 0)
 	{
-		TArray<AActor*> FurnitureWorldActors;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASpyFurniture::StaticClass(), FurnitureWorldActors);
-		TArray<UObject*> AssetManagerObjectList;
-		AssetManager->GetPrimaryAssetObjectList(ItemToDistributeAssetType, AssetManagerObjectList);
-		
-		for (const UObject* AssetManagerObject : AssetManagerObjectList)
+		/** Keep zero reserved for requesting a new seed */
+		ItemDistributionSettings.Seed = FMath::Max<int32>(1, FPlatformTime::Cycles() & MAX_int32);
+	}
+	ItemDistributionStream.Initialize(ItemDistributionSettings.Seed);
+	bItemDistributionSeeded = true;
+
+	UE_LOG(SVSLog, Log, TEXT("SpyItemSubsystem item distribution seed: %i, replay with ?ItemSeed=%i"),
+		ItemDistributionSettings.Seed,
+		ItemDistributionSettings.Seed);
+}
+
+void USpyItemWorldSubsystem::DistributeItemsToFurniture(const TArray<FPrimaryAssetId>& InItemAssetIds)
+{
+	if (InItemAssetIds.Num() == 0)
+	{ return; }
+
+	if (!bItemDistributionSeeded)
+	{ SetItemDistributionSettings(ItemDistributionSettings); }
+
+	const ASpyVsSpyGameState* SpyGameState = GetWorld()->GetGameState<ASpyVsSpyGameState>();
+	const ARoomManager* RoomManager = IsValid(SpyGameState) ? SpyGameState->GetRoomManager() : nullptr;
+
+	/** Candidate furniture with the room it is in and its distance to the spawns */
+	struct FItemDistributionCandidate
+	{
+		ASpyFurniture* SpyFurniture = nullptr;
+		int32 RoomIndex = INDEX_NONE;
+		int32 MinSpawnRoomHops = MAX_int32;
+		int32 TeamRoomHopImbalance = 0;
+	};
+
+	/** Spies are still on their spawns when items are distributed so their rooms stand in for the spawn rooms */
+	TArray<TPair<int32, EPlayerTeam>> SpawnRooms;
+	if (IsValid(RoomManager))
+	{
+		for (const ASpyCharacter* SpyCharacter : SpyCharacterCollection)
 		{
-			const uint8 MaxTries = FurnitureWorldActors.Num();
-			for (uint8 TryIndex = 0; TryIndex < MaxTries; TryIndex++)
-			{
-				const uint8 RandomIndexMax = FurnitureWorldActors.Num() - 1;
-				const int32 RandomIndex = FMath::RandRange(0, RandomIndexMax);
-				const ASpyFurniture* SpyFurniture = Cast<ASpyFurniture>(FurnitureWorldActors[RandomIndex]);
-				const UFurnitureInteractionComponent* FurnitureInteractionComponent = SpyFurniture->GetInteractionComponent();
+			const ASVSRoom* SpawnRoom = IsValid(SpyCharacter) ? RoomManager->FindRoomAtLocation(SpyCharacter->GetActorLocation()) : nullptr;
+			if (!IsValid(SpawnRoom))
+			{ continue; }
 
-				if (IsValid(SpyFurniture) && FurnitureInteractionComponent->IsInteractionEnabled())
-				{
-					const FPrimaryAssetId ObjectPrimaryAssetId = AssetManagerObject->GetPrimaryAssetId();
-					TArray<FPrimaryAssetId> AssetPrimaryIdsToAdd;
-					AssetPrimaryIdsToAdd.AddUnique(ObjectPrimaryAssetId);
-					SpyFurniture->GetInventoryComponent()->SetPrimaryAssetIdsToLoad(AssetPrimaryIdsToAdd);
-					break;
-				}
+			const ASpyPlayerState* SpyPlayerState = SpyCharacter->GetSpyPlayerState();
+			SpawnRooms.Emplace(SpawnRoom->GetRoomIndex(), IsValid(SpyPlayerState) ? SpyPlayerState->GetSpyPlayerTeam() : EPlayerTeam::None);
+		}
+	}
+	
+	const bool bHasBothTeams =
+		SpawnRooms.ContainsByPredicate([](const TPair<int32, EPlayerTeam>& SpawnRoom) { return SpawnRoom.Value == EPlayerTeam::TeamA; }) &&
+		SpawnRooms.ContainsByPredicate([](const TPair<int32, EPlayerTeam>& SpawnRoom) { return SpawnRoom.Value == EPlayerTeam::TeamB; });
 
-				/** Remove actor from candidates so we don't put all items in one basket */
-				const uint8 ActorsRemovedTotal = FurnitureWorldActors.RemoveSingle(FurnitureWorldActors[RandomIndex]);
-				if (ActorsRemovedTotal < 1)
-				{
-					UE_LOG(SVSLog, Warning, TEXT(
-						"SpyItemSubsystem failed to remove actor from distribution array after trying to use it"));
-				}
-			}
+	TArray<FItemDistributionCandidate> Candidates;
+	Candidates.Reserve(SpyFurnitureCollection.Num());
+	for (ASpyFurniture* SpyFurniture : SpyFurnitureCollection)
+	{
+		if (!IsValid(SpyFurniture) ||
+			!IsValid(SpyFurniture->GetInteractionComponent()) ||
+			!SpyFurniture->GetInteractionComponent()->IsInteractionEnabled())
+		{ continue; }
+
+		FItemDistributionCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+		Candidate.SpyFurniture = SpyFurniture;
+
+		const ASVSRoom* FurnitureRoom = IsValid(RoomManager) ? RoomManager->FindRoomAtLocation(SpyFurniture->GetActorLocation()) : nullptr;
+		if (!IsValid(FurnitureRoom))
+		{ continue; }
+
+		Candidate.RoomIndex = FurnitureRoom->GetRoomIndex();
+		int32 MinTeamRoomHops[2] = { MAX_int32, MAX_int32 };
+		for (const TPair<int32, EPlayerTeam>& SpawnRoom : SpawnRooms)
+		{
+			const TArray<uint16>& DistanceRow = RoomManager->GetRoomDistanceRow(SpawnRoom.Key);
+			if (!DistanceRow.IsValidIndex(Candidate.RoomIndex) ||
+				DistanceRow[Candidate.RoomIndex] == ARoomManager::UnreachableRoomDistance)
+			{ continue; }
+
+			const int32 RoomHops = DistanceRow[Candidate.RoomIndex];
+			Candidate.MinSpawnRoomHops = FMath::Min(Candidate.MinSpawnRoomHops, RoomHops);
+			if (SpawnRoom.Value == EPlayerTeam::TeamA)
+			{ MinTeamRoomHops[0] = FMath::Min(MinTeamRoomHops[0], RoomHops); }
+			else if (SpawnRoom.Value == EPlayerTeam::TeamB)
+			{ MinTeamRoomHops[1] = FMath::Min(MinTeamRoomHops[1], RoomHops); }
+		}
+
+		/** A room only one team can reach is never balanced */
+		if (bHasBothTeams)
+		{
+			Candidate.TeamRoomHopImbalance = (MinTeamRoomHops[0] == MAX_int32 || MinTeamRoomHops[1] == MAX_int32) ?
+				MAX_int32 : FMath::Abs(MinTeamRoomHops[0] - MinTeamRoomHops[1]);
+		}
+	}
+
+	if (Candidates.Num() == 0)
+	{
+		UE_LOG(SVSLog, Warning, TEXT("SpyItemSubsystem could not find furniture to distribute %i items to"),
+			InItemAssetIds.Num());
+		return;
+	}
+
+	/** Registration order varies between runs so order candidates by name before the seeded shuffle */
+	Candidates.Sort([](const FItemDistributionCandidate& A, const FItemDistributionCandidate& B)
+		{ return A.SpyFurniture->GetFName().LexicalLess(B.SpyFurniture->GetFName()); });
+	for (int32 CandidateIndex = Candidates.Num() - 1; CandidateIndex > 0; CandidateIndex--)
+	{ Candidates.Swap(CandidateIndex, ItemDistributionStream.RandRange(0, CandidateIndex)); }
+
+	const int32 NumRooms = IsValid(RoomManager) ? RoomManager->GetNumRooms() : 0;
+	TBitArray<> RoomsUsed(false, NumRooms);
+	TBitArray<> CandidatesUsed(false, Candidates.Num());
+	TArray<TArray<FPrimaryAssetId>> CandidateItemAssetIds;
+	CandidateItemAssetIds.SetNum(Candidates.Num());
+	int32 ItemIndex = 0;
+
+	/** Each pass drops the next constraint: team balance, spawn distance and then one item per room */
+	constexpr int32 NumDistributionPasses = 4;
+	int32 DistributionPass = 0;
+	for (; DistributionPass < NumDistributionPasses && ItemIndex < InItemAssetIds.Num(); DistributionPass++)
+	{
+		const bool bCheckTeamBalance = DistributionPass < 1;
+		const bool bCheckSpawnRoomHops = DistributionPass < 2;
+		const bool bCheckOneItemPerRoom = DistributionPass < 3 && ItemDistributionSettings.bOneItemPerRoom;
+
+		for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num() && ItemIndex < InItemAssetIds.Num(); CandidateIndex++)
+		{
+			const FItemDistributionCandidate& Candidate = Candidates[CandidateIndex];
+			const bool bHasRoom = RoomsUsed.IsValidIndex(Candidate.RoomIndex);
+			if (CandidatesUsed[CandidateIndex] ||
+				(bCheckOneItemPerRoom && bHasRoom && RoomsUsed[Candidate.RoomIndex]) ||
+				(bCheckSpawnRoomHops && (!bHasRoom || Candidate.MinSpawnRoomHops < ItemDistributionSettings.MinRoomHopsFromSpawns)) ||
+				(bCheckTeamBalance && (!bHasRoom || Candidate.TeamRoomHopImbalance > ItemDistributionSettings.MaxTeamRoomHopImbalance)))
+			{ continue; }
+
+			CandidateItemAssetIds[CandidateIndex].Emplace(InItemAssetIds[ItemIndex++]);
+			CandidatesUsed[CandidateIndex] = true;
+			if (bHasRoom)
+			{ RoomsUsed[Candidate.RoomIndex] = true; }
 		}
 	}
+
+	/** More items than furniture, share the rest out so no item is lost */
+	for (int32 CandidateIndex = 0; ItemIndex < InItemAssetIds.Num(); CandidateIndex = (CandidateIndex + 1) % Candidates.Num())
+	{ CandidateItemAssetIds[CandidateIndex].Emplace(InItemAssetIds[ItemIndex++]); }
+
+	for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); CandidateIndex++)
+	{
+		if (CandidateItemAssetIds[CandidateIndex].Num() > 0)
+		{ Candidates[CandidateIndex].SpyFurniture->GetInventoryComponent()->SetPrimaryAssetIdsToLoad(CandidateItemAssetIds[CandidateIndex]); }
+	}
+
+	UE_LOG(SVSLogDebug, Log, TEXT("SpyItemSubsystem distributed %i items to %i furniture candidates with seed: %i in %i constraint passes"),
+		InItemAssetIds.Num(),
+		Candidates.Num(),
+		ItemDistributionSettings.Seed,
+		DistributionPass);
 }
@@ -11,11 +11,20 @@
 #include "Players/SpyPlayerController.h"
 #include "Rooms/RoomManager.h"
 #include "Rooms/SpyFurniture.h"
+#include "Kismet/GameplayStatics.h"
 #include "UObject/ConstructorHelpers.h"
 
 ASpyVsSpyGameMode::ASpyVsSpyGameMode()
 {
+	RoomManagerClass = ARoomManager::StaticClass();
+}
+
+void ASpyVsSpyGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
 
+	/** Replay a logged item layout */
+	ItemDistributionSettings.Seed = UGameplayStatics::GetIntOption(Options, TEXT("ItemSeed"), ItemDistributionSettings.Seed);
 }
 
 void ASpyVsSpyGameMode::BeginPlay()
@@ -109,23 +118,40 @@ void ASpyVsSpyGameMode::StartGame()
 	// 	}
 	// }
 
-	/** Load ref to gamestate for further use later */
-	ASpyVsSpyGameState* SpyGameState = GetGameState<ASpyVsSpyGameState>();
-	check(SpyGameState);
-
-	/** load actors in level with required items */
+	/** load actors in level with required items, waiting on the item asset load if it is still in flight */
 	USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>();
-	if (IsValid(SpyItemWorldSubsystem) && SpyItemWorldSubsystem->AllItemsVerifiedLoaded())
+	if (IsValid(SpyItemWorldSubsystem) && !SpyItemWorldSubsystem->AllItemsVerifiedLoaded())
 	{
-		SpyItemWorldSubsystem->DistributeItems(SpyMissionItemTypeToDistributed, ASpyFurniture::StaticClass());
-		SpyItemWorldSubsystem->DistributeItems(SpyWeaponItemTypeToDistributed, ASpyCharacter::StaticClass());
-		SpyItemWorldSubsystem->DistributeItems(SpyTrapItemTypeToDistributed, ASpyCharacter::StaticClass());
+		if (!SpyItemWorldSubsystem->OnAllItemAssetsLoaded.IsBoundToObject(this))
+		{ SpyItemWorldSubsystem->OnAllItemAssetsLoaded.AddUObject(this, &ThisClass::DistributeSpyItemsAndStartMatch); }
+		return;
 	}
-	
+	DistributeSpyItemsAndStartMatch();
+}
+
+void ASpyVsSpyGameMode::DistributeSpyItemsAndStartMatch()
+{
+	DistributeSpyItems();
+
 	/** Start game for network clients */
+	ASpyVsSpyGameState* SpyGameState = GetGameState<ASpyVsSpyGameState>();
+	check(SpyGameState);
 	SpyGameState->MatchStart();
 }
 
+void ASpyVsSpyGameMode::DistributeSpyItems()
+{
+	USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>();
+	if (!IsValid(SpyItemWorldSubsystem))
+	{ return; }
+
+	SpyItemWorldSubsystem->OnAllItemAssetsLoaded.RemoveAll(this);
+	SpyItemWorldSubsystem->SetItemDistributionSettings(ItemDistributionSettings);
+	SpyItemWorldSubsystem->DistributeItems(SpyMissionItemTypeToDistributed, ASpyFurniture::StaticClass());
+	SpyItemWorldSubsystem->DistributeItems(SpyWeaponItemTypeToDistributed, ASpyCharacter::StaticClass());
+	SpyItemWorldSubsystem->DistributeItems(SpyTrapItemTypeToDistributed, ASpyCharacter::StaticClass());
+}
+
 void ASpyVsSpyGameMode::DisplayCountDown()
 {
 	/**
@@ -176,6 +202,7 @@ ARoomManager* ASpyVsSpyGameMode::LoadRoomManager()
 	if (IsValid(RoomManager))
 	{ return RoomManager; }
 	
-	RoomManager = Cast<ARoomManager>(GetWorld()->SpawnActor(ARoomManager::StaticClass()));
+	RoomManager = Cast<ARoomManager>(GetWorld()->SpawnActor(
+		IsValid(RoomManagerClass) ? RoomManagerClass.Get() : ARoomManager::StaticClass()));
 	return RoomManager;
 }
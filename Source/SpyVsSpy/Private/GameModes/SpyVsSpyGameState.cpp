@@ -5,6 +5,7 @@
 
 #include "SVSLogger.h"
 #include "GameModes/SpyVsSpyGameMode.h"
+#include "GameModes/SpyItemWorldSubsystem.h"
 #include "Items/InventoryComponent.h"
 #include "Rooms/RoomManager.h"
 #include "Net/UnrealNetwork.h"
@@ -42,6 +43,7 @@ void ASpyVsSpyGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	SharedParamsRepNotifyChanged.RepNotifyCondition = REPNOTIFY_OnChanged;
 	
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, SpyMatchStartTime, SharedParamsRepNotifyChanged);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ItemHandleRegistryChecksum, SharedParamsRepNotifyChanged);
 }
 
 void ASpyVsSpyGameState::AddPlayerState(APlayerState* PlayerState)
@@ -69,6 +71,13 @@ void ASpyVsSpyGameState::BeginPlay()
 		if (!IsValid(RoomManager))
 		{ UE_LOG(SVSLog, Warning, TEXT("GameState could not get game mode to load a room manager")); }
 	}
+
+	/** Item handles may have been assigned from the preload manifest before the game state existed */
+	if (GetLocalRole() == ROLE_Authority && ItemHandleRegistryChecksum == 0)
+	{
+		if (const USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>())
+		{ SetItemHandleRegistryChecksum(SpyItemWorldSubsystem->GetItemHandleRegistryChecksum()); }
+	}
 	
 	Super::BeginPlay();
 }
@@ -337,6 +346,21 @@ void ASpyVsSpyGameState::GetRequiredMissionItems(TArray<UInventoryBaseAsset*>& R
 	RequestedRequiredMissionItems = RequiredMissionItems;
 }
 
+void ASpyVsSpyGameState::SetItemHandleRegistryChecksum(const uint32 InItemHandleRegistryChecksum)
+{
+	if (!HasAuthority() || InItemHandleRegistryChecksum == ItemHandleRegistryChecksum)
+	{ return; }
+
+	ItemHandleRegistryChecksum = InItemHandleRegistryChecksum;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ItemHandleRegistryChecksum, this);
+}
+
+void ASpyVsSpyGameState::OnRep_ItemHandleRegistryChecksum() const
+{
+	if (const USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>())
+	{ SpyItemWorldSubsystem->VerifyItemHandleRegistryChecksum(); }
+}
+
 void ASpyVsSpyGameState::OnRep_RoomManager()
 {
 	if(!IsValid(RoomManager) && HasAuthority())
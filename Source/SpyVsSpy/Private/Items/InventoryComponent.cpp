@@ -5,6 +5,7 @@
 
 #include "SVSLogger.h"
 #include "Engine/AssetManager.h"
+#include "GameModes/SpyItemWorldSubsystem.h"
 #include "Items/InventoryBaseAsset.h"
 #include "Items/InventoryItemComponent.h"
 #include "Items/InventoryTrapAsset.h"
@@ -16,6 +17,32 @@
 #include "Net/Core/PushModel/PushModel.h"
 #include "Players/SpyCharacter.h"
 #include "Players/SpyPlayerController.h"
+#include "SpyVsSpy/SpyVsSpy.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Held Trap Components Created"), STAT_SVSHeldTrapComponentsCreated, STATGROUP_SpyVsSpy);
+
+void FInventoryItemEntry::PostReplicatedAdd(const FInventoryItemList& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.OwnerComponent))
+	{ InArraySerializer.OwnerComponent->OnInventoryItemAdded(ItemHandle); }
+}
+
+void FInventoryItemEntry::PreReplicatedRemove(const FInventoryItemList& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.OwnerComponent))
+	{ InArraySerializer.OwnerComponent->OnInventoryItemRemoved(ItemHandle); }
+}
+
+bool FInventoryItemList::ContainsItemHandle(const uint8 InItemHandle) const
+{
+	return Items.ContainsByPredicate([InItemHandle](const FInventoryItemEntry& Item) { return Item.ItemHandle == InItemHandle; });
+}
+
+void FInventoryItemList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (IsValid(OwnerComponent))
+	{ OwnerComponent->OnInventoryItemsReplicated(); }
+}
 
 UInventoryComponent::UInventoryComponent()
 {
@@ -24,36 +51,147 @@ UInventoryComponent::UInventoryComponent()
 	TrapHandSocketName = "hand_lSocket";
 
 	DefaultEquippedItemType = EWeaponType::Club;
+	InventoryItemList.OwnerComponent = this;
 }
 
 void UInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InventoryItemList, SharedParams);
+
 	FDoRepLifetimeParams SharedParamsRepAlways;
 	SharedParamsRepAlways.bIsPushBased = true;
 	SharedParamsRepAlways.RepNotifyCondition = REPNOTIFY_Always;
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, PrimaryAssetIdsToLoad, SharedParamsRepAlways);
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, EquippedItemIndex, SharedParamsRepAlways);
 }
 
 void UInventoryComponent::SetPrimaryAssetIdsToLoad(TArray<FPrimaryAssetId>& InPrimaryAssetIdsToLoad)
 {
-	PrimaryAssetIdsToLoad.Append(InPrimaryAssetIdsToLoad);
-	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, PrimaryAssetIdsToLoad, this);
+	USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>();
+	if (!IsValid(SpyItemWorldSubsystem))
+	{ return; }
+	
+	for (const FPrimaryAssetId& PrimaryAssetIdToLoad : InPrimaryAssetIdsToLoad)
+	{
+		const uint8 ItemHandle = SpyItemWorldSubsystem->GetItemHandle(PrimaryAssetIdToLoad);
+		if (ItemHandle == USpyItemWorldSubsystem::InvalidItemHandle)
+		{
+			UE_LOG(SVSLog, Warning, TEXT("Actor: %s InventoryComponent has no item handle for asset: %s"),
+				*GetOwner()->GetName(),
+				*PrimaryAssetIdToLoad.ToString());
+			continue;
+		}
+		if (InventoryItemList.ContainsItemHandle(ItemHandle))
+		{ continue; }
+
+		/** Only the new entry is marked so only it is sent */
+		FInventoryItemEntry& NewItem = InventoryItemList.Items.AddDefaulted_GetRef();
+		NewItem.ItemHandle = ItemHandle;
+		InventoryItemList.MarkItemDirty(NewItem);
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InventoryItemList, this);
+
+		if (IsValid(GetWorld()->GetAuthGameMode()))
+		{ OnInventoryItemAdded(ItemHandle); }
+	}
+}
+
+bool UInventoryComponent::RemoveInventoryItem(UInventoryBaseAsset* InInventoryAsset)
+{
+	USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>();
+	if (!IsValid(InInventoryAsset) ||
+		!IsValid(SpyItemWorldSubsystem) ||
+		!IsValid(GetWorld()->GetAuthGameMode()))
+	{ return false; }
+
+	const uint8 ItemHandle = SpyItemWorldSubsystem->GetItemHandle(InInventoryAsset->GetPrimaryAssetId());
+	const int32 ItemIndex = InventoryItemList.Items.IndexOfByPredicate(
+		[ItemHandle](const FInventoryItemEntry& Item) { return Item.ItemHandle == ItemHandle; });
+	if (ItemIndex == INDEX_NONE)
+	{ return false; }
+
+	/** Removing from the asset collection shifts later items down so the equipped index has to follow */
+	const int32 RemovedAssetIndex = InventoryAssetsCollection.Find(InInventoryAsset);
+	const bool bRemovingEquippedItem = RemovedAssetIndex != INDEX_NONE && RemovedAssetIndex == EquippedItemIndex;
+	if (bRemovingEquippedItem)
+	{ UnEquipCurrentItem(); }
+
+	InventoryItemList.Items.RemoveAtSwap(ItemIndex);
+	InventoryItemList.MarkArrayDirty();
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InventoryItemList, this);
+	
+	OnInventoryItemRemoved(ItemHandle);
+
+	if (bRemovingEquippedItem)
+	{
+		/** Fall back to the default item, or nothing equipped once the inventory is empty */
+		EquippedItemIndex = 255;
+		EquipInventoryItem(EItemRotationDirection::Initial);
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, EquippedItemIndex, this);
+	}
+	else if (RemovedAssetIndex != INDEX_NONE && RemovedAssetIndex < EquippedItemIndex && InventoryAssetsCollection.IsValidIndex(EquippedItemIndex - 1))
+	{
+		EquippedItemIndex--;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, EquippedItemIndex, this);
+	}
+	return true;
+}
+
+USpyItemWorldSubsystem* UInventoryComponent::GetLoadedItemWorldSubsystem()
+{
+	USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>();
+	if (!IsValid(SpyItemWorldSubsystem))
+	{ return nullptr; }
 
-	if (IsValid(GetWorld()->GetAuthGameMode()))
+	/** Entries replicate before a client has finished loading item assets, resolve them once it has */
+	if (!SpyItemWorldSubsystem->AllItemsVerifiedLoaded())
 	{
-		for (const FPrimaryAssetId& PrimaryAssetIdToLoad : PrimaryAssetIdsToLoad)
-		{ LoadInventoryAssetFromAssetId(PrimaryAssetIdToLoad); }
+		if (!SpyItemWorldSubsystem->OnAllItemAssetsLoaded.IsBoundToObject(this))
+		{ SpyItemWorldSubsystem->OnAllItemAssetsLoaded.AddUObject(this, &ThisClass::OnItemAssetsLoaded); }
+		return nullptr;
 	}
+	return SpyItemWorldSubsystem;
+}
+
+void UInventoryComponent::OnItemAssetsLoaded()
+{
+	USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>();
+	if (!IsValid(SpyItemWorldSubsystem))
+	{ return; }
+	
+	SpyItemWorldSubsystem->OnAllItemAssetsLoaded.RemoveAll(this);
+	for (const FInventoryItemEntry& Item : InventoryItemList.Items)
+	{ AddInventoryAsset(SpyItemWorldSubsystem->GetItemAssetByHandle(Item.ItemHandle)); }
+
+	if (!IsValid(GetWorld()->GetAuthGameMode()))
+	{ OnInventoryItemsReplicated(); }
 }
 
-void UInventoryComponent::OnRep_PrimaryAssetIdsToLoad()
+void UInventoryComponent::OnInventoryItemAdded(const uint8 InItemHandle)
 {
-	for (const FPrimaryAssetId& PrimaryAssetIdToLoad : PrimaryAssetIdsToLoad)
-	{ LoadInventoryAssetFromAssetId(PrimaryAssetIdToLoad); }
+	if (USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetLoadedItemWorldSubsystem())
+	{ AddInventoryAsset(SpyItemWorldSubsystem->GetItemAssetByHandle(InItemHandle)); }
+}
+
+void UInventoryComponent::OnInventoryItemRemoved(const uint8 InItemHandle)
+{
+	if (USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetLoadedItemWorldSubsystem())
+	{
+		UInventoryBaseAsset* RemovedItemAsset = SpyItemWorldSubsystem->GetItemAssetByHandle(InItemHandle);
+		InventoryAssetsCollection.Remove(RemovedItemAsset);
+		ReleasePooledWeapon(Cast<UInventoryWeaponAsset>(RemovedItemAsset));
+	}
+}
 
+void UInventoryComponent::OnInventoryItemsReplicated()
+{
+	/** The equipped index can replicate before the items it points at have resolved */
+	if (InventoryAssetsCollection.IsValidIndex(EquippedItemIndex) &&
+		EquippedItemAsset != InventoryAssetsCollection[EquippedItemIndex])
+	{ OnRep_EquippedItemIndex(); }
+	
 	/** If this load is done on a client while they are playing then display contents of inventory in UI */
 	const ASpyCharacter* SpyCharacter = Cast<ASpyCharacter>(GetOwner());
 	if (IsValid(SpyCharacter) &&
@@ -67,7 +205,7 @@ void UInventoryComponent::OnRep_PrimaryAssetIdsToLoad()
 
 bool UInventoryComponent::AddInventoryItems(TArray<FPrimaryAssetId>& PrimaryAssetIdCollectionToLoad)
 {
-	if (PrimaryAssetIdsToLoad.Num() >= 1)
+	if (InventoryItemList.Items.Num() >= 1)
 	{
 		for (FPrimaryAssetId PrimaryAssetId : PrimaryAssetIdCollectionToLoad)
 		{ LoadInventoryAssetFromAssetId(PrimaryAssetId); }
@@ -77,21 +215,6 @@ bool UInventoryComponent::AddInventoryItems(TArray<FPrimaryAssetId>& PrimaryAsse
 	return false;
 }
 
-bool UInventoryComponent::RemoveInventoryItem(UInventoryItemComponent* InInventoryItem)
-{
-	if (!IsValid(InInventoryItem)) { return false; }
-	
-	// TODO validation checks
-
-	// TODO Implement
-	// if(InventoryCollection.RemoveSingle(InInventoryItem) == 1)
-	// {
-	// 	InInventoryItem->DestroyComponent();
-	// 	return true;
-	// }
-	return false;
-}
-
 void UInventoryComponent::GetInventoryItems(TArray<UInventoryBaseAsset*>& InInventoryItems) const
 {
 	InInventoryItems = InventoryAssetsCollection;
@@ -112,18 +235,7 @@ void UInventoryComponent::LoadInventoryAssetFromAssetId(const FPrimaryAssetId& I
 	{
 		UObject* AssetManagerObject = AssetManager->GetPrimaryAssetObject(InInventoryAssetId);
 		if (UInventoryBaseAsset* SpyItem = Cast<UInventoryBaseAsset>(AssetManagerObject))
-		{
-			const uint8 AddedItemIndex = InventoryAssetsCollection.AddUnique(SpyItem);
-
-			/** On Server set default first weapon actor and asset to club when we add it */
-			if (const UInventoryWeaponAsset* SpyWeaponItem = Cast<UInventoryWeaponAsset>(SpyItem))
-			{
-				const ASpyCharacter* CharacterOwner = Cast<ASpyCharacter>(GetOwner());
-				if (IsValid(CharacterOwner) &&
-					SpyWeaponItem->WeaponType == DefaultEquippedItemType)
-				{ InventoryAssetsCollection.Swap(0, AddedItemIndex); }
-			}
-		}
+		{ AddInventoryAsset(SpyItem); }
 		else
 		{
 			UE_LOG(SVSLog, Log, TEXT("Actor: %s InventoryComponent tried to load asset from PID but cast failed for object: %s"),
@@ -133,6 +245,27 @@ void UInventoryComponent::LoadInventoryAssetFromAssetId(const FPrimaryAssetId& I
 	}
 }
 
+void UInventoryComponent::AddInventoryAsset(UInventoryBaseAsset* InInventoryAsset)
+{
+	if (!IsValid(InInventoryAsset))
+	{ return; }
+	
+	const uint8 AddedItemIndex = InventoryAssetsCollection.AddUnique(InInventoryAsset);
+
+	/** On Server set default first weapon actor and asset to club when we add it */
+	if (const UInventoryWeaponAsset* SpyWeaponItem = Cast<UInventoryWeaponAsset>(InInventoryAsset))
+	{
+		const ASpyCharacter* CharacterOwner = Cast<ASpyCharacter>(GetOwner());
+		if (IsValid(CharacterOwner) &&
+			SpyWeaponItem->WeaponType == DefaultEquippedItemType)
+		{ InventoryAssetsCollection.Swap(0, AddedItemIndex); }
+
+		/** Pre-spawn the local weapon so cycling items never spawns actors */
+		if (IsValid(CharacterOwner))
+		{ GetPooledWeapon(SpyWeaponItem); }
+	}
+}
+
 void UInventoryComponent::SetInventoryOwnerType(const EInventoryOwnerType InInventoryOwnerType)
 {
 	InventoryOwnerType = InInventoryOwnerType;
@@ -224,8 +357,7 @@ void UInventoryComponent::S_EquipInventoryItem_Implementation(const EItemRotatio
 void UInventoryComponent::OnRep_EquippedItemIndex()
 {
 	if (IsRunningDedicatedServer() ||
-		!IsValid(GetOwner()) ||
-		!InventoryAssetsCollection.IsValidIndex(EquippedItemIndex))
+		!IsValid(GetOwner()))
 	{
 		UE_LOG(SVSLog, Warning,
 			TEXT("Inventory Component ran OnRep_EquippedItemIndex with index: %i but has no owner"),
@@ -233,12 +365,20 @@ void UInventoryComponent::OnRep_EquippedItemIndex()
 		return;
 	}
 
-	/** Client only cares about unequiping a trap asset since that is only equiped on the client */
-	if (Cast<UInventoryTrapAsset>(EquippedItemAsset))
-	{ UnEquipCurrentItem(); }
+	/** Clients hold their own trap visuals and pooled weapons so swap them locally */
+	UnEquipCurrentItem();
+
+	/** Nothing equipped, or the items the index points at have not resolved yet */
+	if (!InventoryAssetsCollection.IsValidIndex(EquippedItemIndex))
+	{
+		OnEquippedUpdated.Broadcast();
+		return;
+	}
 	
 	if (const UInventoryTrapAsset* TrapAsset = Cast<UInventoryTrapAsset>(InventoryAssetsCollection[EquippedItemIndex]))
 	{ EquipTrap(TrapAsset); }
+	else if (UInventoryWeaponAsset* WeaponAsset = Cast<UInventoryWeaponAsset>(InventoryAssetsCollection[EquippedItemIndex]))
+	{ EquipWeapon(WeaponAsset); }
 
 	EquippedItemAsset = InventoryAssetsCollection[EquippedItemIndex];
 	OnEquippedUpdated.Broadcast();
@@ -246,108 +386,165 @@ void UInventoryComponent::OnRep_EquippedItemIndex()
 
 bool UInventoryComponent::EquipTrap(const UInventoryTrapAsset* TrapAsset)
 {
-	/** Create the visual representation of the trap to be held by the player */
-	if (ASpyCharacter* OwnerCharacter = Cast<ASpyCharacter>(GetOwner()))
-	{
-		UTrapMeshComponent* NewHeldTrap = NewObject<UTrapMeshComponent>(
-			OwnerCharacter,
-			UTrapMeshComponent::StaticClass());
-
-		if (IsValid(NewHeldTrap))
-		{
-			NewHeldTrap->TrapName = TrapAsset->InventoryItemName;
-			NewHeldTrap->RegisterComponent();
-			NewHeldTrap->SetStaticMesh(TrapAsset->TrapMesh);
+	/** Show the visual representation of the trap to be held by the player */
+	UTrapMeshComponent* HeldTrap = GetPooledHeldTrap();
+	if (!IsValid(HeldTrap) || !IsValid(TrapAsset))
+	{ return false; }
 
-			const bool bDidAttach = NewHeldTrap->AttachToComponent(
-				OwnerCharacter->GetMesh(),
-				FAttachmentTransformRules::SnapToTargetIncludingScale,
-				TrapHandSocketName);
+	/** Only the mesh and its placement in the hand change between traps */
+	HeldTrap->TrapName = TrapAsset->InventoryItemName;
+	HeldTrap->SetStaticMesh(TrapAsset->TrapMesh.Get());
+	HeldTrap->SetRelativeTransform(TrapAsset->HeldTrapAttachTransform);
+	HeldTrap->SetVisibility(true);
+	CurrentHeldTrap = HeldTrap;
+	return true;
+}
 
-			NewHeldTrap->SetRelativeTransform(TrapAsset->HeldTrapAttachTransform);
+UTrapMeshComponent* UInventoryComponent::GetPooledHeldTrap()
+{
+	for (UTrapMeshComponent* PooledHeldTrap : HeldTrapPool)
+	{
+		if (IsValid(PooledHeldTrap) && !PooledHeldTrap->IsVisible())
+		{ return PooledHeldTrap; }
+	}
 
-			if (bDidAttach)
-			{ CurrentHeldTrap = NewHeldTrap; }
-			else
-			{
-				NewHeldTrap->DestroyComponent();
-				UE_LOG(SVSLog, Warning, TEXT("%s InventoryComponent could not attach trap visual component for asset: %s"),
-					*GetOwner()->GetName(),
-					*TrapAsset->InventoryItemName.ToString());
-			}
-			return bDidAttach;
-		}
+	ASpyCharacter* OwnerCharacter = Cast<ASpyCharacter>(GetOwner());
+	if (!IsValid(OwnerCharacter))
+	{ return nullptr; }
+	
+	UTrapMeshComponent* NewHeldTrap = NewObject<UTrapMeshComponent>(
+		OwnerCharacter,
+		UTrapMeshComponent::StaticClass());
+	if (!IsValid(NewHeldTrap))
+	{ return nullptr; }
+
+	NewHeldTrap->RegisterComponent();
+	const bool bDidAttach = NewHeldTrap->AttachToComponent(
+		OwnerCharacter->GetMesh(),
+		FAttachmentTransformRules::SnapToTargetIncludingScale,
+		TrapHandSocketName);
+	if (!bDidAttach)
+	{
+		NewHeldTrap->DestroyComponent();
+		UE_LOG(SVSLog, Warning, TEXT("%s InventoryComponent could not attach trap visual component"),
+			*GetOwner()->GetName());
+		return nullptr;
 	}
-	return false;
+
+	INC_DWORD_STAT(STAT_SVSHeldTrapComponentsCreated);
+	NewHeldTrap->SetVisibility(false);
+	HeldTrapPool.Emplace(NewHeldTrap);
+	return NewHeldTrap;
 }
 
 bool UInventoryComponent::EquipWeapon(UInventoryWeaponAsset* WeaponAsset)
 {
-	const ASpyCharacter* CharacterOwner = Cast<ASpyCharacter>(GetOwner());
-	const TSubclassOf<AWeapon> WeaponClass = WeaponAsset->WeaponClass;
-	if (!IsValid(CharacterOwner) || !IsValid(WeaponClass))
+	AWeapon* PooledWeapon = GetPooledWeapon(WeaponAsset);
+	if (!IsValid(PooledWeapon))
 	{ return false; }
+
+	PooledWeapon->SetWeaponActive(true);
+	CurrentSpawnedWeapon = PooledWeapon;
+	EquippedItemAsset = WeaponAsset;
+	return true;
+}
+
+AWeapon* UInventoryComponent::GetPooledWeapon(const UInventoryWeaponAsset* WeaponAsset)
+{
+	if (AWeapon* PooledWeapon = WeaponPool.FindRef(WeaponAsset))
+	{
+		if (IsValid(PooledWeapon))
+		{ return PooledWeapon; }
+	}
+	
+	ASpyCharacter* CharacterOwner = Cast<ASpyCharacter>(GetOwner());
+	if (!IsValid(WeaponAsset) || !IsValid(CharacterOwner))
+	{ return nullptr; }
+	
+	const TSubclassOf<AWeapon> WeaponClass = WeaponAsset->WeaponClass;
+	if (!IsValid(WeaponClass))
+	{ return nullptr; }
 	
 	AWeapon* NewWeapon = GetOwner()->GetWorld()->SpawnActorDeferred<AWeapon>(
 		WeaponClass,
 		FTransform::Identity,
-		nullptr,
-		nullptr,
+		CharacterOwner,
+		CharacterOwner,
 		ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
 
-	bool bEquipResult = false;
-
-	if (IsValid(NewWeapon))
-	{
-		NewWeapon->FinishSpawning(FTransform::Identity, /*bIsDefaultTransform=*/ true);
-		bEquipResult = NewWeapon->AttachToComponent(
-			CharacterOwner->GetMesh(),
-			FAttachmentTransformRules::SnapToTargetIncludingScale,
-			WeaponHandSocketName);
-
-		/** Needs to occur after attaching to character so that initial visibility of weapon can be established */
-		const bool bWeaponDidLoadProps = NewWeapon->LoadWeaponPropertyValuesFromDataAsset(WeaponAsset);
-		
-		/** Fail if we cannot attach */
-		if (!bEquipResult || !bWeaponDidLoadProps)
-		{
-			UE_LOG(SVSLog, Warning, TEXT("Character: %s InventoryComponent ran EquipWeapon but could not attach weapon or load its properties from the data asset"),
-				*GetOwner()->GetName());
-
-			const bool bDidDestroy = NewWeapon->Destroy();
-			ensureAlwaysMsgf(
-				bDidDestroy,
-				TEXT("InventoryWeaponAsset could not destroy recently created weapon during Equip with a failed attachment"));
-
-			return false;
-		}
-		
-		CurrentSpawnedWeapon = NewWeapon;
-		
-		// TODO find a way to refactor this in a better manner
-		/** Set the weapon to block against the opponent's character mesh Object Type,
-		 * should be either channel ECC_GameTraceChannel3 or ECC_GameTraceChannel4 */
-		const ECollisionChannel OwnerMeshCollisionObjectType = Cast<ACharacter>(GetOwner())->GetMesh()->GetCollisionObjectType();
-		ECollisionChannel ChannelBlockingAgainst = ECollisionChannel::ECC_Vehicle; // TODO also find a better default
-		if (OwnerMeshCollisionObjectType == ECC_GameTraceChannel3)
-		{ChannelBlockingAgainst = ECC_GameTraceChannel4; }
-		else if (OwnerMeshCollisionObjectType == ECC_GameTraceChannel4)
-		{ ChannelBlockingAgainst = ECC_GameTraceChannel3; }
-		
-		NewWeapon->UpdateCollisionChannelResponseToBlock(
-			ChannelBlockingAgainst,
-			OwnerMeshCollisionObjectType);
-	}
-	else
+	if (!IsValid(NewWeapon))
 	{
 		UE_LOG(SVSLog, Warning,
-			TEXT("Character: %s InventoryComponent ran EquipWeapon but could not Spawn weapon of Class: %s"),
+			TEXT("Character: %s InventoryComponent could not Spawn weapon of Class: %s"),
 			*GetOwner()->GetName(),
 			*WeaponClass->GetName());
+		return nullptr;
 	}
+	
+	NewWeapon->FinishSpawning(FTransform::Identity, /*bIsDefaultTransform=*/ true);
+	const bool bDidAttach = NewWeapon->AttachToComponent(
+		CharacterOwner->GetMesh(),
+		FAttachmentTransformRules::SnapToTargetIncludingScale,
+		WeaponHandSocketName);
+
+	/** Needs to occur after attaching to character so that initial visibility of weapon can be established */
+	const bool bWeaponDidLoadProps = NewWeapon->LoadWeaponPropertyValuesFromDataAsset(WeaponAsset);
+	
+	/** Fail if we cannot attach */
+	if (!bDidAttach || !bWeaponDidLoadProps)
+	{
+		UE_LOG(SVSLog, Warning, TEXT("Character: %s InventoryComponent could not attach weapon or load its properties from the data asset"),
+			*GetOwner()->GetName());
 
-	EquippedItemAsset = WeaponAsset;
-	return bEquipResult;
+		const bool bDidDestroy = NewWeapon->Destroy();
+		ensureAlwaysMsgf(
+			bDidDestroy,
+			TEXT("InventoryWeaponAsset could not destroy recently created weapon during Equip with a failed attachment"));
+
+		return nullptr;
+	}
+	
+	// TODO find a way to refactor this in a better manner
+	/** Set the weapon to block against the opponent's character mesh Object Type,
+	 * should be either channel ECC_GameTraceChannel3 or ECC_GameTraceChannel4 */
+	const ECollisionChannel OwnerMeshCollisionObjectType = CharacterOwner->GetMesh()->GetCollisionObjectType();
+	ECollisionChannel ChannelBlockingAgainst = ECollisionChannel::ECC_Vehicle; // TODO also find a better default
+	if (OwnerMeshCollisionObjectType == ECC_GameTraceChannel3)
+	{ChannelBlockingAgainst = ECC_GameTraceChannel4; }
+	else if (OwnerMeshCollisionObjectType == ECC_GameTraceChannel4)
+	{ ChannelBlockingAgainst = ECC_GameTraceChannel3; }
+	
+	NewWeapon->UpdateCollisionChannelResponseToBlock(
+		ChannelBlockingAgainst,
+		OwnerMeshCollisionObjectType);
+
+	/** Stays in the pool until equipped */
+	NewWeapon->SetWeaponActive(false);
+	WeaponPool.Emplace(WeaponAsset, NewWeapon);
+	return NewWeapon;
+}
+
+void UInventoryComponent::ReleasePooledWeapon(const UInventoryWeaponAsset* WeaponAsset)
+{
+	AWeapon* PooledWeapon = nullptr;
+	if (!WeaponPool.RemoveAndCopyValue(WeaponAsset, PooledWeapon) || !IsValid(PooledWeapon))
+	{ return; }
+
+	if (CurrentSpawnedWeapon.Get() == PooledWeapon)
+	{ CurrentSpawnedWeapon.Reset(); }
+	PooledWeapon->Destroy();
+}
+
+void UInventoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (const TPair<const UInventoryWeaponAsset*, AWeapon*>& PooledWeapon : WeaponPool)
+	{
+		if (IsValid(PooledWeapon.Value))
+		{ PooledWeapon.Value->Destroy(); }
+	}
+	WeaponPool.Empty();
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void UInventoryComponent::ResetEquipped()
@@ -367,24 +564,33 @@ bool UInventoryComponent::UnEquipCurrentItem()
 
 	/** Assumes the Spy character is either holding a weapon or a trap, never both */
 	
-	/** Remove weapon actor from server */
-	if (IsValid(CurrentSpawnedWeapon.Get()) && IsRunningDedicatedServer())
-	{ return CurrentSpawnedWeapon->Destroy(true); }
+	/** Return weapon actor to the local pool */
+	if (IsValid(CurrentSpawnedWeapon.Get()))
+	{
+		CurrentSpawnedWeapon->SetWeaponActive(false);
+		CurrentSpawnedWeapon.Reset();
+		return true;
+	}
 	if (IsRunningDedicatedServer())
 	{ return true; } /** server only concerned with weapona actors */
 
 	/** Remove trap visual on clients */
 	if (IsValid(CurrentHeldTrap.Get()) && !IsRunningDedicatedServer())
 	{
-		CurrentHeldTrap->DestroyComponent();
+		/** Back to the pool for the next trap */
+		CurrentHeldTrap->SetVisibility(false);
+		CurrentHeldTrap.Reset();
 		return true;
 	}
 
 	return false;
 }
 
-void UInventoryComponent::EnableWeaponAttackPhase(const bool bEnableAttackPhase)
+void UInventoryComponent::EnableWeaponAttackPhase(const bool bEnableAttackPhase, const float InMontagePosition)
 {
+	if (!GetOwner()->HasAuthority())
+	{ return; }
+	
 	if (IsValid(CurrentSpawnedWeapon.Get()))
-	{ CurrentSpawnedWeapon->EnableOnTickComponentSweeps(bEnableAttackPhase); }
+	{ CurrentSpawnedWeapon->EnableOnTickComponentSweeps(bEnableAttackPhase, InMontagePosition); }
 }
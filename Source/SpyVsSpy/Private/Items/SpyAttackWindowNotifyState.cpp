@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Items/SpyAttackWindowNotifyState.h"
+
+#include "Animation/AnimMontage.h"
+#include "Players/SpyCharacter.h"
+
+void USpyAttackWindowNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+
+	ASpyCharacter* SpyCharacter = IsValid(MeshComp) ? Cast<ASpyCharacter>(MeshComp->GetOwner()) : nullptr;
+	if (!IsValid(SpyCharacter))
+	{ return; }
+
+	/** Trigger times are montage positions only when the notify sits on the montage itself */
+	const FAnimNotifyEvent* NotifyEvent = EventReference.GetNotify();
+	SpyCharacter->StartPrimaryAttackWindow(NotifyEvent && Cast<UAnimMontage>(Animation) ? NotifyEvent->GetTriggerTime() : -1.0f);
+}
+
+void USpyAttackWindowNotifyState::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+	
+	ASpyCharacter* SpyCharacter = IsValid(MeshComp) ? Cast<ASpyCharacter>(MeshComp->GetOwner()) : nullptr;
+	if (!IsValid(SpyCharacter))
+	{ return; }
+
+	const FAnimNotifyEvent* NotifyEvent = EventReference.GetNotify();
+	SpyCharacter->CompletePrimaryAttackWindow(NotifyEvent && Cast<UAnimMontage>(Animation) ? NotifyEvent->GetEndTriggerTime() : -1.0f);
+}
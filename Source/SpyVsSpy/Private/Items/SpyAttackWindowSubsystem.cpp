@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Items/SpyAttackWindowSubsystem.h"
+
+#include "Items/Weapon.h"
+#include "SpyVsSpy/SpyVsSpy.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Attack Windows"), STAT_SVSActiveAttackWindows, STATGROUP_SpyVsSpy);
+DECLARE_CYCLE_STAT(TEXT("Sweep Attack Windows"), STAT_SVSSweepAttackWindows, STATGROUP_SpyVsSpy);
+
+void USpyAttackWindowSubsystem::OpenAttackWindow(AWeapon* InWeapon)
+{
+	if (!IsValid(InWeapon) || ActiveAttackWindowWeapons.Contains(InWeapon))
+	{ return; }
+
+	ActiveAttackWindowWeapons.Add(InWeapon);
+	INC_DWORD_STAT(STAT_SVSActiveAttackWindows);
+}
+
+void USpyAttackWindowSubsystem::CloseAttackWindow(AWeapon* InWeapon)
+{
+	if (ActiveAttackWindowWeapons.RemoveSingleSwap(InWeapon) > 0)
+	{ DEC_DWORD_STAT(STAT_SVSActiveAttackWindows); }
+}
+
+void USpyAttackWindowSubsystem::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_SVSActiveAttackWindows, ActiveAttackWindowWeapons.Num());
+	ActiveAttackWindowWeapons.Reset();
+	
+	Super::Deinitialize();
+}
+
+void USpyAttackWindowSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SVSSweepAttackWindows);
+	Super::Tick(DeltaTime);
+
+	/** Hits close windows while sweeping so work from a copy */
+	const TArray<AWeapon*, TInlineAllocator<8>> WeaponsToSweep(ActiveAttackWindowWeapons);
+	for (AWeapon* Weapon : WeaponsToSweep)
+	{
+		if (!IsValid(Weapon))
+		{
+			CloseAttackWindow(Weapon);
+			continue;
+		}
+		
+		if (Weapon->IsAttackWindowOpen())
+		{ Weapon->SweepWeapon(); }
+	}
+}
+
+TStatId USpyAttackWindowSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpyAttackWindowSubsystem, STATGROUP_Tickables);
+}
+
+bool USpyAttackWindowSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -4,18 +4,25 @@
 #include "Items/Weapon.h"
 
 #include "SVSLogger.h"
+#include "AnimationRuntime.h"
+#include "Animation/AnimMontage.h"
 #include "Items/InventoryWeaponAsset.h"
-#include "Net/Core/PushModel/PushModel.h"
-#include "Net/UnrealNetwork.h"
+#include "Items/SpyAttackWindowSubsystem.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
 #include "Players/SpyCharacter.h"
+#include "SpyVsSpy/SpyVsSpy.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Weapon Sweep Sub Steps"), STAT_SVSWeaponSweepSubSteps, STATGROUP_SpyVsSpy);
 
 // Sets default values
 AWeapon::AWeapon()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
-	bReplicates = true;
-	bAlwaysRelevant = true;
+	/** Sweeps are driven by the Attack Window Subsystem only while an attack window is open */
+	PrimaryActorTick.bCanEverTick = false;
+	/** Each machine spawns its own pooled weapons from the owner's replicated inventory,
+	 * so weapon state travels with the owning character and shares its relevancy */
+	bReplicates = false;
 
 	SkeletalMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>("SkeletalMeshComponent");
 	if (IsValid(SkeletalMeshComponent))
@@ -24,7 +31,6 @@ AWeapon::AWeapon()
 		SkeletalMeshComponent->AlwaysLoadOnClient = true;
 		SkeletalMeshComponent->AlwaysLoadOnServer = true;
 		SkeletalMeshComponent->bOwnerNoSee = false;
-		SkeletalMeshComponent->SetIsReplicated(true);
 		
 		/** This actor will be attached to a Character actor and
 		 * UE does not allow a child actor to simulate physics differently than the root component,
@@ -44,73 +50,182 @@ AWeapon::AWeapon()
 	}
 }
 
-void AWeapon::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void AWeapon::SweepWeapon()
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	ASpyCharacter* OwningSpyCharacter = Cast<ASpyCharacter>(GetAttachParentActor());
+	if (!IsValid(OwningSpyCharacter))
+	{ return; }
 
-	FDoRepLifetimeParams SharedParams;
-	SharedParams.bIsPushBased = true;
-	SharedParams.RepNotifyCondition = REPNOTIFY_Always;
-	SharedParams.Condition = COND_None;
+	/** Sample the attack montage between ticks so results do not depend on the tick rate */
+	const UAnimMontage* AttackMontage = nullptr;
+	float MontagePosition = 0.0f;
+	float MontagePlayRate = 1.0f;
+	if (OwningSpyCharacter->GetActiveMontagePosition(AttackMontage, MontagePosition, MontagePlayRate))
+	{
+		SweepWeaponSubSteps(OwningSpyCharacter, AttackMontage, MontagePosition, MontagePlayRate, GetWorld()->GetTimeSeconds());
+		return;
+	}
 
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, WeaponMesh, SharedParams);
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, bEnableOnTickComponentSweeps, SharedParams);
+	/** Without a montage to sample sweep from the previous tick's transform to the current one */
+	SweepWeaponSample(
+		OwningSpyCharacter,
+		GetMesh()->GetComponentTransform(),
+		OwningSpyCharacter->GetMesh()->GetSocketTransform(GetAttachParentSocketName()),
+		GetWorld()->GetTimeSeconds());
 }
 
-void AWeapon::Tick(float DeltaTime)
+void AWeapon::SweepWeaponSubSteps(ASpyCharacter* InSpyCharacter, const UAnimMontage* InMontage, const float InMontagePosition, const float InPlayRate, const double InServerTime)
 {
-	Super::Tick(DeltaTime);
+	const FTransform CurrentMeshTransform = InSpyCharacter->GetMesh()->GetComponentTransform();
+	
+	/** A new montage mid window, or one the window opened without, only seeds the previous sample */
+	if (SweepMontage.Get() != InMontage || LastSweepMontagePosition < 0.0f || InMontagePosition < LastSweepMontagePosition)
+	{
+		SweepMontage = InMontage;
+		LastSweepMontagePosition = InMontagePosition;
+		LastSweepMeshTransform = CurrentMeshTransform;
+		return;
+	}
 
-	if (bEnableOnTickComponentSweeps)
-	{ SweepWeapon(); }
+	const float PositionDelta = InMontagePosition - LastSweepMontagePosition;
+	if (PositionDelta <= UE_KINDA_SMALL_NUMBER)
+	{ return; }
+
+	/** Samples sit on a fixed grid of montage time, time after the last grid point carries to the next tick */
+	const float SubStep = FMath::Max(AttackSubStepSeconds * FMath::Abs(InPlayRate), UE_KINDA_SMALL_NUMBER);
+	const FTransform WeaponRelativeTransform = GetRootComponent()->GetRelativeTransform();
+	const FName SocketName = GetAttachParentSocketName();
+	float SamplePosition = (FMath::FloorToFloat(LastSweepMontagePosition / SubStep) + 1.0f) * SubStep;
+	int32 SubStepCount = 0;
+	for (; SamplePosition <= InMontagePosition && SubStepCount < MaxAttackSubStepsPerTick; SamplePosition += SubStep, SubStepCount++)
+	{
+		/** Character movement between ticks is interpolated, the hand comes from the montage itself */
+		const float Alpha = (SamplePosition - LastSweepMontagePosition) / PositionDelta;
+		FTransform SampleMeshTransform;
+		SampleMeshTransform.Blend(LastSweepMeshTransform, CurrentMeshTransform, Alpha);
+		
+		FTransform SocketComponentTransform;
+		if (!InSpyCharacter->GetMontageSocketComponentTransform(InMontage, SamplePosition, SocketName, SocketComponentTransform))
+		{ break; }
+		const FTransform SocketTransform = SocketComponentTransform * SampleMeshTransform;
+		const double SampleServerTime = InServerTime - (InMontagePosition - SamplePosition) / FMath::Max(FMath::Abs(InPlayRate), UE_KINDA_SMALL_NUMBER);
+
+		/** A hit ends the attack window */
+		if (SweepWeaponSample(InSpyCharacter, WeaponRelativeTransform * SocketTransform, SocketTransform, SampleServerTime) ||
+			!bEnableOnTickComponentSweeps)
+		{ break; }
+	}
+
+	INC_DWORD_STAT_BY(STAT_SVSWeaponSweepSubSteps, SubStepCount);
+	LastSweepMontagePosition = InMontagePosition;
+	LastSweepMeshTransform = CurrentMeshTransform;
 }
 
-void AWeapon::SweepWeapon()
+bool AWeapon::SweepWeaponSample(ASpyCharacter* InSpyCharacter, const FTransform& InWeaponTransform, const FTransform& InSocketTransform, const double InSampleServerTime)
 {
-	if (UWorld* WeaponWorld = GetWorld())
+	/** Server decides hits against opponents as the attacking client saw them,
+	 * weapons are spawned locally so authority comes from the owning character */
+	if (InSpyCharacter->HasAuthority() && GetNetMode() != NM_Standalone)
+	{
+		TArray<FWeaponAttackCapsule, TInlineAllocator<4>> WorldAttackCapsules;
+		if (UsesAttackVolumes())
+		{ GetAttackVolumeCapsules(AttackCapsules, InSocketTransform, WorldAttackCapsules); }
+		else
+		{ GetAttackVolumeCapsules(MeshAttackCapsules, InWeaponTransform, WorldAttackCapsules); }
+
+		FHitResult LagCompensatedHit;
+		if (!InSpyCharacter->FindLagCompensatedHit(WorldAttackCapsules, InSampleServerTime, LagCompensatedHit))
+		{ return false; }
+
+		InSpyCharacter->HandlePrimaryAttackHit(LagCompensatedHit);
+		return true;
+	}
+
+	/** Standalone games have no rewind history so sweep the mesh, from the previous sample to this one */
+	const FVector TraceStart = OnComponentSweepEnableStartLocation;
+	const FVector TraceEnd = InWeaponTransform.GetLocation();
+	OnComponentSweepEnableStartLocation = TraceEnd;
+
+	/** ComponentSweepMulti does nothing if moving < KINDA_SMALL_NUMBER in distance, so
+	 * it's important to not try to sweep distances smaller than that. */ 
+	constexpr float MinMovementDistSq = FMath::Square(4.f* UE_KINDA_SMALL_NUMBER);
+	if ((TraceEnd - TraceStart).SizeSquared() <= MinMovementDistSq)
+	{ return false; }
+	
+	TArray<FHitResult> OutHits;
+	GetWorld()->ComponentSweepMulti(
+		OutHits,
+		GetMesh(),
+		TraceStart,
+		TraceEnd,
+		InWeaponTransform.GetRotation(),
+		SweepQueryParams);
+
+	bool bHitFound = false;
+	for (const FHitResult& OutHit : OutHits)
 	{
-		/** Calc distances */
-		const FVector TraceStart = GetMesh()->GetComponentLocation();
-		const FVector Delta = TraceStart - OnComponentSweepEnableStartLocation;
-		const FVector TraceEnd = TraceStart + Delta;
-		/** Update Start Location for next tick */
-		OnComponentSweepEnableStartLocation = TraceEnd;
-			
-		/** Recalc here to account for precision loss of float addition */
-		float DeltaSizeSq = (TraceEnd - TraceStart).SizeSquared();
-		const FQuat InitialRotationQuat = GetMesh()->GetComponentTransform().GetRotation();
-
-		/** ComponentSweepMulti does nothing if moving < KINDA_SMALL_NUMBER in distance, so
-		 * it's important to not try to sweep distances smaller than that. */ 
-		constexpr float MinMovementDistSq = FMath::Square(4.f* UE_KINDA_SMALL_NUMBER);
-		if (DeltaSizeSq > MinMovementDistSq)
+		if (GetAttachParentActor() != OutHit.Component->GetAttachParentActor())
 		{
-			TArray<FHitResult> OutHits;
-			const bool bOutHitsFound = WeaponWorld->ComponentSweepMulti(
-				OutHits,
-				GetMesh(),
-				TraceStart,
-				TraceEnd,
-				InitialRotationQuat,
-				SweepQueryParams);
-
-			for (FHitResult OutHit : OutHits)
-			{
-				if (GetAttachParentActor() != OutHit.Component->GetAttachParentActor())
-				{
-					if (ASpyCharacter* SpyCharacter = Cast<ASpyCharacter>(GetAttachParentActor()))
-					{ SpyCharacter->HandlePrimaryAttackHit(OutHit); }
-				}
-			}
+			InSpyCharacter->HandlePrimaryAttackHit(OutHit);
+			bHitFound = true;
 		}
 	}
+	return bHitFound;
 }
 
-void AWeapon::OnRep_bEnableOnTickComponentSweeps()
+void AWeapon::SweepToClosingMontagePosition(const float InMontagePosition)
+{
+	ASpyCharacter* OwningSpyCharacter = Cast<ASpyCharacter>(GetAttachParentActor());
+	const UAnimMontage* AttackMontage = nullptr;
+	float MontagePosition = 0.0f;
+	float MontagePlayRate = 1.0f;
+	if (!IsValid(OwningSpyCharacter) ||
+		!OwningSpyCharacter->GetActiveMontagePosition(AttackMontage, MontagePosition, MontagePlayRate) ||
+		SweepMontage.Get() != AttackMontage ||
+		InMontagePosition <= LastSweepMontagePosition ||
+		InMontagePosition > MontagePosition)
+	{ return; }
+
+	/** The notify fired during this tick's montage advance, samples up to it are rewound from now */
+	const double CloseServerTime = GetWorld()->GetTimeSeconds() -
+		(MontagePosition - InMontagePosition) / FMath::Max(FMath::Abs(MontagePlayRate), UE_KINDA_SMALL_NUMBER);
+	SweepWeaponSubSteps(OwningSpyCharacter, AttackMontage, InMontagePosition, MontagePlayRate, CloseServerTime);
+}
+
+void AWeapon::ApplyOnTickComponentSweeps(const float InMontagePosition)
 {
 	if (bEnableOnTickComponentSweeps)
-	{ OnComponentSweepEnableStartLocation = GetMesh()->GetComponentLocation(); } else
+	{
+		OnComponentSweepEnableStartLocation = GetMesh()->GetComponentLocation();
+		PreviousAttackCapsuleEnds.Reset();
+	} else
 	{ OnComponentSweepEnableStartLocation = FVector::ZeroVector; }
+	
+	SweepMontage.Reset();
+	LastSweepMontagePosition = -1.0f;
+
+	/** Seed from the notify opening the window so montage time before the first tick is swept */
+	const ASpyCharacter* OwningSpyCharacter = Cast<ASpyCharacter>(GetAttachParentActor());
+	const UAnimMontage* AttackMontage = nullptr;
+	float MontagePosition = 0.0f;
+	float MontagePlayRate = 1.0f;
+	if (bEnableOnTickComponentSweeps &&
+		IsValid(OwningSpyCharacter) &&
+		OwningSpyCharacter->GetActiveMontagePosition(AttackMontage, MontagePosition, MontagePlayRate))
+	{
+		SweepMontage = AttackMontage;
+		LastSweepMontagePosition = InMontagePosition >= 0.0f && InMontagePosition <= MontagePosition ?
+			InMontagePosition :
+			MontagePosition;
+		LastSweepMeshTransform = OwningSpyCharacter->GetMesh()->GetComponentTransform();
+	}
+
+	if (USpyAttackWindowSubsystem* AttackWindowSubsystem = GetWorld()->GetSubsystem<USpyAttackWindowSubsystem>())
+	{
+		bEnableOnTickComponentSweeps ?
+			AttackWindowSubsystem->OpenAttackWindow(this) :
+			AttackWindowSubsystem->CloseAttackWindow(this);
+	}
 }
 
 void AWeapon::BeginPlay()
@@ -118,13 +233,32 @@ void AWeapon::BeginPlay()
 	Super::BeginPlay();
 }
 
-void AWeapon::OnRep_SetMesh()
+void AWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	GetMesh()->SetSkeletalMesh(WeaponMesh);
+	if (USpyAttackWindowSubsystem* AttackWindowSubsystem = GetWorld()->GetSubsystem<USpyAttackWindowSubsystem>())
+	{ AttackWindowSubsystem->CloseAttackWindow(this); }
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+void AWeapon::SetWeaponActive(const bool bInWeaponActive)
+{
+	bWeaponActive = bInWeaponActive;
+	if (!bWeaponActive && bEnableOnTickComponentSweeps)
+	{ EnableOnTickComponentSweeps(false); }
+	
+	GetMesh()->SetCollisionEnabled(bWeaponActive ? ECollisionEnabled::ProbeOnly : ECollisionEnabled::NoCollision);
+	UpdateWeaponVisibility();
+}
+
+void AWeapon::UpdateWeaponVisibility()
+{
+	/** Nothing to render on dedicated servers, clients hide opponents locally */
+	if (IsRunningDedicatedServer())
+	{ return; }
 	
-	/* Determine if initial visibility needs to be hidden for remote players */
-	if (const AActor* OwningActor = GetAttachParentActor())
-	{ SetActorHiddenInGame(OwningActor->IsHidden()); }
+	const AActor* OwningActor = GetAttachParentActor();
+	SetActorHiddenInGame(!bWeaponActive || (IsValid(OwningActor) && OwningActor->IsHidden()));
 }
 
 bool AWeapon::LoadWeaponPropertyValuesFromDataAsset(const UInventoryWeaponAsset* InventoryWeaponAsset)
@@ -133,36 +267,140 @@ bool AWeapon::LoadWeaponPropertyValuesFromDataAsset(const UInventoryWeaponAsset*
 	{ return false; }
 
 	WeaponMesh = InventoryWeaponAsset->WeaponMesh;
-	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, WeaponMesh, this);
 	GetMesh()->SetSkeletalMesh(WeaponMesh);
 	
 	WeaponType = InventoryWeaponAsset->WeaponType;
+	HitDetectionMode = InventoryWeaponAsset->HitDetectionMode;
+	AttackCapsules = InventoryWeaponAsset->AttackCapsules;
+	BuildMeshAttackCapsules();
 
 	/** Damage Info */
 	bInstaKillEnabled = InventoryWeaponAsset->bInstaKillEnabled;
 	if (!bInstaKillEnabled)
 	{ WeaponAttackBaseDamage = InventoryWeaponAsset->WeaponAttackBaseDamage; }
 
-	/** VFX */
-	AttackVisualEffect = InventoryWeaponAsset->AttackVisualEffect;
-	AttackDamageVisualEffect = InventoryWeaponAsset->AttackDamageVisualEffect;
-	AttackFatalDamageVisualEffect = InventoryWeaponAsset->AttackFatalDamageVisualEffect;
+	/** VFX, cosmetic bundle is not loaded on dedicated servers */
+	AttackVisualEffect = InventoryWeaponAsset->AttackVisualEffect.Get();
+	AttackDamageVisualEffect = InventoryWeaponAsset->AttackDamageVisualEffect.Get();
+	AttackFatalDamageVisualEffect = InventoryWeaponAsset->AttackFatalDamageVisualEffect.Get();
 
 	/** SFX */
-	AttackSoundEffect = InventoryWeaponAsset->AttackSoundEffect;
-	AttackDamageSoundEffect = InventoryWeaponAsset->AttackDamageSoundEffect;
+	AttackSoundEffect = InventoryWeaponAsset->AttackSoundEffect.Get();
+	AttackDamageSoundEffect = InventoryWeaponAsset->AttackDamageSoundEffect.Get();
 
 	return true;
 }
 
-void AWeapon::EnableOnTickComponentSweeps(const bool bEnable)
+void AWeapon::GetAttackVolumeCapsules(const TArray<FWeaponAttackCapsule>& InLocalCapsules, const FTransform& InTransform, TArray<FWeaponAttackCapsule, TInlineAllocator<4>>& OutWorldCapsules)
 {
-	bEnableOnTickComponentSweeps = bEnable;
-	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, bEnableOnTickComponentSweeps, this);
+	const bool bHasPreviousEnds = PreviousAttackCapsuleEnds.Num() == InLocalCapsules.Num();
+	PreviousAttackCapsuleEnds.SetNum(InLocalCapsules.Num());
+	for (int32 CapsuleIndex = 0; CapsuleIndex < InLocalCapsules.Num(); CapsuleIndex++)
+	{
+		const FWeaponAttackCapsule& AttackCapsule = InLocalCapsules[CapsuleIndex];
+		FWeaponAttackCapsule& WorldCapsule = OutWorldCapsules.Add_GetRef(AttackCapsule);
+		WorldCapsule.Start = InTransform.TransformPosition(AttackCapsule.Start);
+		WorldCapsule.End = InTransform.TransformPosition(AttackCapsule.End);
+
+		/** The far end moves fastest in a swing, cover the path it took so fast swings do not tunnel */
+		if (bHasPreviousEnds)
+		{
+			FWeaponAttackCapsule& TrailCapsule = OutWorldCapsules.Add_GetRef(AttackCapsule);
+			TrailCapsule.Start = PreviousAttackCapsuleEnds[CapsuleIndex];
+			TrailCapsule.End = WorldCapsule.End;
+		}
+		PreviousAttackCapsuleEnds[CapsuleIndex] = WorldCapsule.End;
+	}
+}
+
+void AWeapon::BuildMeshAttackCapsules()
+{
+	MeshAttackCapsules.Reset();
+	if (!IsValid(WeaponMesh))
+	{ return; }
+
+	/** Physics asset bodies are the weapon's collision shape, boxes are covered by a capsule along their longest axis */
+	const FReferenceSkeleton& RefSkeleton = WeaponMesh->GetRefSkeleton();
+	const UPhysicsAsset* WeaponPhysicsAsset = WeaponMesh->GetPhysicsAsset();
+	if (IsValid(WeaponPhysicsAsset))
+	{
+		for (const USkeletalBodySetup* BodySetup : WeaponPhysicsAsset->SkeletalBodySetups)
+		{
+			if (!IsValid(BodySetup))
+			{ continue; }
+			const int32 BoneIndex = RefSkeleton.FindBoneIndex(BodySetup->BoneName);
+			if (BoneIndex == INDEX_NONE)
+			{ continue; }
+			const FTransform BoneTransform = FAnimationRuntime::GetComponentSpaceTransformRefPose(RefSkeleton, BoneIndex);
+
+			for (const FKSphylElem& SphylElem : BodySetup->AggGeom.SphylElems)
+			{
+				const FTransform ElemTransform = SphylElem.GetTransform() * BoneTransform;
+				FWeaponAttackCapsule& MeshCapsule = MeshAttackCapsules.AddDefaulted_GetRef();
+				MeshCapsule.Start = ElemTransform.TransformPosition(FVector(0.0f, 0.0f, -0.5f * SphylElem.Length));
+				MeshCapsule.End = ElemTransform.TransformPosition(FVector(0.0f, 0.0f, 0.5f * SphylElem.Length));
+				MeshCapsule.Radius = SphylElem.Radius;
+			}
+			for (const FKSphereElem& SphereElem : BodySetup->AggGeom.SphereElems)
+			{
+				FWeaponAttackCapsule& MeshCapsule = MeshAttackCapsules.AddDefaulted_GetRef();
+				MeshCapsule.Start = MeshCapsule.End = BoneTransform.TransformPosition(SphereElem.Center);
+				MeshCapsule.Radius = SphereElem.Radius;
+			}
+			for (const FKBoxElem& BoxElem : BodySetup->AggGeom.BoxElems)
+			{
+				const FTransform ElemTransform = BoxElem.GetTransform() * BoneTransform;
+				const FVector HalfExtent = 0.5f * FVector(BoxElem.X, BoxElem.Y, BoxElem.Z);
+				AddBoxAttackCapsule(ElemTransform, HalfExtent);
+			}
+		}
+	}
+
+	/** Without a physics asset the mesh bounds box is the closest shape available */
+	if (MeshAttackCapsules.IsEmpty())
+	{
+		const FBoxSphereBounds LocalBounds = WeaponMesh->GetBounds();
+		AddBoxAttackCapsule(FTransform(LocalBounds.Origin), LocalBounds.BoxExtent);
+	}
+}
+
+void AWeapon::AddBoxAttackCapsule(const FTransform& InBoxTransform, const FVector& InHalfExtent)
+{
+	const int32 LongAxis = InHalfExtent.X >= InHalfExtent.Y ?
+		(InHalfExtent.X >= InHalfExtent.Z ? 0 : 2) :
+		(InHalfExtent.Y >= InHalfExtent.Z ? 1 : 2);
 	
-	/** Perform onrep function on server as well */
-	if (!IsRunningClientOnly())
-	{ OnRep_bEnableOnTickComponentSweeps();}
+	/** The capsule radius reaches the box edges around the long axis */
+	FVector ShortExtent = InHalfExtent;
+	ShortExtent[LongAxis] = 0.0f;
+	const float Radius = ShortExtent.Size();
+	FVector SegmentHalf = FVector::ZeroVector;
+	SegmentHalf[LongAxis] = FMath::Max(InHalfExtent[LongAxis] - Radius, 0.0f);
+
+	FWeaponAttackCapsule& MeshCapsule = MeshAttackCapsules.AddDefaulted_GetRef();
+	MeshCapsule.Start = InBoxTransform.TransformPosition(-SegmentHalf);
+	MeshCapsule.End = InBoxTransform.TransformPosition(SegmentHalf);
+	MeshCapsule.Radius = Radius;
+}
+
+void AWeapon::EnableOnTickComponentSweeps(const bool bEnable, const float InMontagePosition)
+{
+	if (bEnable && !bWeaponActive)
+	{ return; }
+	
+	if (bEnableOnTickComponentSweeps == bEnable)
+	{ return; }
+
+	/** A hit during the final sweep closes the window itself */
+	if (!bEnable && InMontagePosition >= 0.0f)
+	{
+		SweepToClosingMontagePosition(InMontagePosition);
+		if (!bEnableOnTickComponentSweeps)
+		{ return; }
+	}
+	
+	bEnableOnTickComponentSweeps = bEnable;
+	ApplyOnTickComponentSweeps(InMontagePosition);
 }
 
 void AWeapon::UpdateCollisionChannelResponseToBlock(const ECollisionChannel EnemyObjectChannel, const ECollisionChannel SelfObjectChannel)
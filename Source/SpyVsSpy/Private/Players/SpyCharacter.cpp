@@ -12,6 +12,10 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Controller.h"
 #include "GameFramework/GameModeBase.h"
+#include "GameFramework/GameStateBase.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequence.h"
+#include "Engine/SkeletalMeshSocket.h"
 #include "SVSLogger.h"
 #include "AbilitySystem/SpyGameplayAbility.h"
 #include "AbilitySystemBlueprintLibrary.h"
@@ -19,8 +23,11 @@
 #include "AbilitySystem/SpyAttributeSet.h"
 #include "Abilities/GameplayAbilityTypes.h"
 #include "GameModes/SpyVsSpyGameMode.h"
+#include "GameModes/SpyVsSpyGameState.h"
+#include "GameModes/SpyItemWorldSubsystem.h"
 #include "Items/InventoryComponent.h"
 #include "Items/InventoryWeaponAsset.h"
+#include "Items/Weapon.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Rooms/RoomManager.h"
@@ -39,6 +46,21 @@ ASpyCharacter::ASpyCharacter()
 	/** Set size for collision capsule */
 	GetCapsuleComponent()->InitCapsuleSize(35.0f, 90.0f);
 
+	/** Head, torso and legs volumes sized to the collision capsule for server hit tests */
+	auto MakeHitCapsule = [](const FName Name, const float BottomZ, const float TopZ, const float Radius)
+	{
+		FSpyHitCapsule HitCapsule;
+		HitCapsule.Name = Name;
+		HitCapsule.Start = FVector(0.0f, 0.0f, BottomZ);
+		HitCapsule.End = FVector(0.0f, 0.0f, TopZ);
+		HitCapsule.Radius = Radius;
+		return HitCapsule;
+	};
+	HitCapsules = {
+		MakeHitCapsule(FName("head"), 58.0f, 70.0f, 15.0f),
+		MakeHitCapsule(FName("spine_03"), -5.0f, 40.0f, 25.0f),
+		MakeHitCapsule(FName("pelvis"), -70.0f, -10.0f, 18.0f) };
+
 	SpyInteractionComponent = CreateDefaultSubobject<USpyInteractionComponent>("Interaction Component");
 	SpyInteractionComponent->SetupAttachment(RootComponent);
 	SpyInteractionComponent->SetRelativeLocation(FVector(25.0f, 0.0f, 0.0f));
@@ -141,6 +163,71 @@ void ASpyCharacter::BeginPlay()
 	{
 		PlayerInventoryComponent->OnEquippedUpdated.AddUniqueDynamic(this, &ThisClass::EquippedItemUpdated);
 	}
+
+	/** Let the item subsystem know this character can hold items */
+	if (USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>())
+	{ SpyItemWorldSubsystem->RegisterSpyCharacter(this); }
+}
+
+void ASpyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>())
+	{ SpyItemWorldSubsystem->UnregisterSpyCharacter(this); }
+
+	/** Occupancy sampling cannot exit a room for a character that is already gone */
+	const ASpyVsSpyGameState* SpyGameState = GetWorld()->GetGameState<ASpyVsSpyGameState>();
+	if (ARoomManager* RoomManager = IsValid(SpyGameState) ? SpyGameState->GetRoomManager() : nullptr)
+	{ RoomManager->UntrackSpyCharacter(this); }
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASpyCharacter::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	/** Only the server validates attacks so only the server needs pose history */
+	if (GetLocalRole() == ROLE_Authority && GetNetMode() != NM_Standalone)
+	{ RecordPoseSnapshot(); }
+}
+
+bool ASpyCharacter::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	/** Owners always see their own spy */
+	if (bAlwaysRelevant || IsOwnedBy(RealViewer) || this == ViewTarget)
+	{ return true; }
+
+	/** Room rules need both spies placed in rooms, otherwise use engine rules */
+	const ASpyCharacter* ViewingSpyCharacter = Cast<ASpyCharacter>(ViewTarget);
+	const ASpyVsSpyGameMode* SpyGameMode = GetWorld()->GetAuthGameMode<ASpyVsSpyGameMode>();
+	if (EnterRelevantRoomHops < 0 ||
+		!IsValid(CurrentRoom) ||
+		!IsValid(ViewingSpyCharacter) ||
+		!IsValid(ViewingSpyCharacter->GetCurrentRoom()) ||
+		!IsValid(SpyGameMode) ||
+		!IsValid(SpyGameMode->GetRoomManager()))
+	{ return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation); }
+
+	/** Spies in unseen rooms are hidden on the viewer anyway so skip replicating them and their weapons,
+	 * a spy already relevant keeps replicating until it is past the leave hops.
+	 * Only the net driver calls this, on the game thread, so updating the mutable viewer set is safe */
+	const int32 RoomDistance = SpyGameMode->GetRoomManager()->GetRoomDistance(ViewingSpyCharacter->GetCurrentRoom(), CurrentRoom);
+	const bool bWasRoomRelevant = RoomRelevantViewers.Contains(RealViewer);
+	const int32 RelevantRoomHops = bWasRoomRelevant ? FMath::Max(LeaveRelevantRoomHops, EnterRelevantRoomHops) : EnterRelevantRoomHops;
+	const bool bIsRoomRelevant = RoomDistance != INDEX_NONE && RoomDistance <= RelevantRoomHops;
+	if (bIsRoomRelevant && !bWasRoomRelevant)
+	{
+		/** Drop viewers which have since left the match */
+		for (TSet<TWeakObjectPtr<const AActor>>::TIterator ViewerIt = RoomRelevantViewers.CreateIterator(); ViewerIt; ++ViewerIt)
+		{
+			if (!ViewerIt->IsValid())
+			{ ViewerIt.RemoveCurrent(); }
+		}
+		RoomRelevantViewers.Emplace(RealViewer);
+	}
+	else if (!bIsRoomRelevant && bWasRoomRelevant)
+	{ RoomRelevantViewers.Remove(RealViewer); }
+	return bIsRoomRelevant;
 }
 
 void ASpyCharacter::OnOverlapBegin(AActor* OverlappedActor, AActor* OtherActor)
@@ -148,6 +235,10 @@ void ASpyCharacter::OnOverlapBegin(AActor* OverlappedActor, AActor* OtherActor)
 	/* If OtherActor is a Room then capture the room which character is trying to enter */
 	if (ASVSRoom* SVSRoomOverlapped = Cast<ASVSRoom>(OtherActor))
 	{
+		/** Room Manager handles room changes when it tracks occupancy */
+		if (!SVSRoomOverlapped->IsOccupancyTriggerEnabled())
+		{ return; }
+		
 		/** Prep for room transfer if already in a room,
 		 * this multi part process helps reduce change of bugs due to character clipping
 		 * as they cannot be in a new room if they have not left the old room */
@@ -176,6 +267,17 @@ void ASpyCharacter::OnOverlapEnd(AActor* OverlappedActor, AActor* OtherActor)
 	}
 }
 
+void ASpyCharacter::SetTrackedRoom(ASVSRoom* InTrackedRoom)
+{
+	if (!IsValid(InTrackedRoom) || InTrackedRoom == CurrentRoom)
+	{ return; }
+
+	/** Sampling has no partial overlaps so the room change is processed immediately */
+	bHasTeleported = false;
+	RoomEntering = InTrackedRoom;
+	ProcessRoomChange(RoomEntering);
+}
+
 void ASpyCharacter::OnCelebrationMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
 	if (!IsValid(SpyPlayerState) ||
@@ -231,18 +333,24 @@ void ASpyCharacter::SetSpyHidden(const bool bIsSpyHidden)
 	TArray<AActor*> AttachedActors;
 	GetAttachedActors(AttachedActors);
 	for (AActor* AttachedActor : AttachedActors)
-	{ AttachedActor->SetActorHiddenInGame(bIsHiddenInGame); }
+	{
+		/** Pooled weapons which are not equipped stay hidden */
+		if (AWeapon* AttachedWeapon = Cast<AWeapon>(AttachedActor))
+		{ AttachedWeapon->UpdateWeaponVisibility(); }
+		else
+		{ AttachedActor->SetActorHiddenInGame(bIsHiddenInGame); }
+	}
 }
 
-void ASpyCharacter::StartPrimaryAttackWindow()
+void ASpyCharacter::StartPrimaryAttackWindow(const float InNotifyMontagePosition)
 {
 	if (GetWorld()->GetNetMode() == NM_Client)
 	{ return; }
 
-	SetAttackActive(true);
+	SetAttackActive(true, InNotifyMontagePosition);
 }
 
-void ASpyCharacter::CompletePrimaryAttackWindow()
+void ASpyCharacter::CompletePrimaryAttackWindow(const float InNotifyMontagePosition)
 {
 	if (GetLocalRole() == ROLE_SimulatedProxy)
 	{ return; }
@@ -250,7 +358,7 @@ void ASpyCharacter::CompletePrimaryAttackWindow()
 	/** Notify ability of zero hits */
 	if (!bAttackHitFound)
 	{
-		SetAttackActive(false);
+		SetAttackActive(false, InNotifyMontagePosition);
 		/** Payload setup to send to GameplayEvent to Actor */
 		const FGameplayTag ResultTag = FGameplayTag::RequestGameplayTag("Attack.NoHit");
 		FGameplayEventData Payload = FGameplayEventData();
@@ -444,32 +552,13 @@ FVector ASpyCharacter::GetSpyRespawnLocation()
 	if (!IsValid(SpyGameMode))
 	{ return FVector::ZeroVector; }
 	
-	/** Get a collection of unoccupied rooms from room manager */
+	/** Room manager picks a collision free point away from opponents and recent deaths */
 	ARoomManager* RoomManager = SpyGameMode->GetRoomManager();
-	TArray<FRoomListing> RoomCandidatesForSpyRelocation;
-	RoomManager->GetRoomListingCollection(RoomCandidatesForSpyRelocation, false);
-
 	FVector SpyRelocationTarget = FVector::ZeroVector;
-
-	/** Try and get a random room from the collection to use as location of respawn */
-	if (RoomCandidatesForSpyRelocation.Num() > 0)
-	{
-		const uint8 RandomRangeMax = RoomCandidatesForSpyRelocation.Num() - 1;
-		const int32 RandomIntFromRange = FMath::RandRange(0, RandomRangeMax);
-		if (const ASVSRoom* CandidateRoom = RoomCandidatesForSpyRelocation[RandomIntFromRange].Room)
-		{ SpyRelocationTarget = CandidateRoom->GetActorLocation(); }
-		else
-		{
-			UE_LOG(SVSLog, Warning, TEXT(
-				"%s Character: %s room respawn candidate was not valid"),
-				IsLocallyControlled() ? *FString("Local") : *FString("Remote"),
-				*GetName());
-		}
-	}
-	else
+	if (!IsValid(RoomManager) || !RoomManager->FindRespawnLocation(this, SpyRelocationTarget))
 	{
 		UE_LOG(SVSLog, Warning, TEXT(
-			"%s Character: %s room respawn got zero room listings"),
+			"%s Character: %s room respawn found no spawn point"),
 			IsLocallyControlled() ? *FString("Local") : *FString("Remote"),
 			*GetName());
 	}
@@ -489,6 +578,13 @@ void ASpyCharacter::S_RequestDeath_Implementation()
 	if (SpyPlayerState->GetCurrentStatus() != EPlayerGameStatus::Playing)
 	{ return; }
 
+	/** Respawns avoid recent fights */
+	if (const ASpyVsSpyGameMode* SpyGameMode = GetWorld()->GetAuthGameMode<ASpyVsSpyGameMode>())
+	{
+		if (ARoomManager* RoomManager = SpyGameMode->GetRoomManager())
+		{ RoomManager->RecordSpyDeath(GetActorLocation()); }
+	}
+
 	/** Apply a time penalty to the player for dying */
 	SpyPlayerState->SetPlayerRemainingMatchTime(0.0f, true);
 	NM_SetEnableDeathState(true);
@@ -556,11 +652,15 @@ void ASpyCharacter::FinishDeath()
 	{ NM_SetEnableDeathState(false, GetSpyRespawnLocation()); }
 }
 
-void ASpyCharacter::SetAttackActive(const bool bEnabled) const
+void ASpyCharacter::SetAttackActive(const bool bEnabled, const float InNotifyMontagePosition) const
 {
-	GetPlayerInventoryComponent()->EnableWeaponAttackPhase(bEnabled);
+	GetPlayerInventoryComponent()->EnableWeaponAttackPhase(bEnabled, InNotifyMontagePosition);
+
+	/** Attack volumes sample the hand socket from the montage so bones can stay stale on the server */
+	const AWeapon* EquippedWeapon = GetPlayerInventoryComponent()->GetEquippedWeapon();
+	if (bEnabled && IsValid(EquippedWeapon) && EquippedWeapon->UsesAttackVolumes())
+	{ return; }
 	
-	// TODO can we just tick hand bone or perhaps use replicated movement on the attack component?
 	/** Required for using component collisions off of animation montages
 	 * otherwise location of component is not replicated.
 	 * This might conflict with ragdolling on simulated proxy */
@@ -609,6 +709,201 @@ void ASpyCharacter::HandlePrimaryAttackHit(const FHitResult& HitResult)
 	}
 }
 
+void ASpyCharacter::RecordPoseSnapshot()
+{
+	if (PoseHistory.Num() != PoseHistorySize)
+	{
+		PoseHistory.SetNum(FMath::Max(PoseHistorySize, 2));
+		PoseHistoryHead = INDEX_NONE;
+	}
+
+	/** Overwrite the oldest entry */
+	PoseHistoryHead = (PoseHistoryHead + 1) % PoseHistory.Num();
+	FSpyPoseSnapshot& Snapshot = PoseHistory[PoseHistoryHead];
+	Snapshot.ServerTime = GetWorld()->GetTimeSeconds();
+	Snapshot.CapsuleLocation = GetCapsuleComponent()->GetComponentLocation();
+	Snapshot.CapsuleRotation = GetCapsuleComponent()->GetComponentQuat();
+	Snapshot.CapsuleRadius = GetCapsuleComponent()->GetScaledCapsuleRadius();
+	Snapshot.CapsuleHalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+}
+
+bool ASpyCharacter::GetPoseAtServerTime(const double InServerTime, FSpyPoseSnapshot& OutPose) const
+{
+	if (PoseHistoryHead == INDEX_NONE)
+	{ return false; }
+
+	/** Walk back from the newest snapshot to find the pair bracketing the requested time */
+	const int32 HistoryNum = PoseHistory.Num();
+	const FSpyPoseSnapshot* Newer = &PoseHistory[PoseHistoryHead];
+	if (InServerTime >= Newer->ServerTime)
+	{
+		OutPose = *Newer;
+		return true;
+	}
+	
+	for (int32 Step = 1; Step < HistoryNum; Step++)
+	{
+		const FSpyPoseSnapshot& Older = PoseHistory[(PoseHistoryHead - Step + HistoryNum) % HistoryNum];
+		/** Unfilled entries have no time, clamp to the oldest real snapshot */
+		if (Older.ServerTime <= 0.0)
+		{ break; }
+		
+		if (Older.ServerTime <= InServerTime)
+		{
+			const float Alpha = static_cast<float>(
+				(InServerTime - Older.ServerTime) / FMath::Max(Newer->ServerTime - Older.ServerTime, UE_DOUBLE_SMALL_NUMBER));
+			OutPose.ServerTime = InServerTime;
+			OutPose.CapsuleLocation = FMath::Lerp(Older.CapsuleLocation, Newer->CapsuleLocation, Alpha);
+			OutPose.CapsuleRotation = FQuat::Slerp(Older.CapsuleRotation, Newer->CapsuleRotation, Alpha);
+			OutPose.CapsuleRadius = Newer->CapsuleRadius;
+			OutPose.CapsuleHalfHeight = Newer->CapsuleHalfHeight;
+			return true;
+		}
+		Newer = &Older;
+	}
+
+	/** Requested time is older than the buffer holds */
+	OutPose = *Newer;
+	return true;
+}
+
+bool ASpyCharacter::FindLagCompensatedHit(TConstArrayView<FWeaponAttackCapsule> WorldAttackCapsules, const double InAttackServerTime, FHitResult& OutHit) const
+{
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	if (GetLocalRole() != ROLE_Authority || !IsValid(GameState) || WorldAttackCapsules.IsEmpty())
+	{ return false; }
+
+	const double RewindServerTime = InAttackServerTime - AttackRewindSeconds;
+	const ASpyPlayerState* AttackerPlayerState = GetPlayerState<ASpyPlayerState>();
+	const EPlayerTeam AttackerTeam = IsValid(AttackerPlayerState) ? AttackerPlayerState->GetSpyPlayerTeam() : EPlayerTeam::None;
+	float ClosestHitDistSq = TNumericLimits<float>::Max();
+	for (const APlayerState* PlayerState : GameState->PlayerArray)
+	{
+		ASpyCharacter* Opponent = IsValid(PlayerState) ? Cast<ASpyCharacter>(PlayerState->GetPawn()) : nullptr;
+		if (!IsValid(Opponent) || Opponent == this)
+		{ continue; }
+
+		/** Weapons only block the opposing team's mesh channel, keep teammates out of the analytic test too */
+		const ASpyPlayerState* OpponentPlayerState = Cast<ASpyPlayerState>(PlayerState);
+		if (AttackerTeam != EPlayerTeam::None &&
+			IsValid(OpponentPlayerState) &&
+			OpponentPlayerState->GetSpyPlayerTeam() == AttackerTeam)
+		{ continue; }
+
+		FSpyPoseSnapshot Pose;
+		if (!Opponent->GetPoseAtServerTime(RewindServerTime, Pose))
+		{ continue; }
+		const FTransform PoseTransform = FTransform(Pose.CapsuleRotation, Pose.CapsuleLocation);
+
+		/** Fall back to the collision capsule when no body part volumes are set up */
+		const float CollisionSegmentHalfLength = FMath::Max(Pose.CapsuleHalfHeight - Pose.CapsuleRadius, 0.0f);
+		FSpyHitCapsule CollisionCapsule;
+		CollisionCapsule.Start = FVector(0.0f, 0.0f, -CollisionSegmentHalfLength);
+		CollisionCapsule.End = FVector(0.0f, 0.0f, CollisionSegmentHalfLength);
+		CollisionCapsule.Radius = Pose.CapsuleRadius;
+		const TConstArrayView<FSpyHitCapsule> OpponentHitCapsules = Opponent->HitCapsules.IsEmpty() ?
+			MakeArrayView(&CollisionCapsule, 1) :
+			MakeArrayView(Opponent->HitCapsules);
+
+		for (const FSpyHitCapsule& HitCapsule : OpponentHitCapsules)
+		{
+			const FVector HitCapsuleStart = PoseTransform.TransformPosition(HitCapsule.Start);
+			const FVector HitCapsuleEnd = PoseTransform.TransformPosition(HitCapsule.End);
+			for (const FWeaponAttackCapsule& AttackCapsule : WorldAttackCapsules)
+			{
+				/** Two capsules overlap when their inner segments are closer than the sum of their radii */
+				FVector AttackPoint;
+				FVector HitCapsulePoint;
+				FMath::SegmentDistToSegmentSafe(
+					AttackCapsule.Start,
+					AttackCapsule.End,
+					HitCapsuleStart,
+					HitCapsuleEnd,
+					AttackPoint,
+					HitCapsulePoint);
+				if (FVector::DistSquared(AttackPoint, HitCapsulePoint) > FMath::Square(AttackCapsule.Radius + HitCapsule.Radius))
+				{ continue; }
+
+				/** Report the hit reached first from the leading edge of the attack */
+				const float HitDistSq = FVector::DistSquared(AttackCapsule.Start, AttackPoint);
+				if (HitDistSq >= ClosestHitDistSq)
+				{ continue; }
+				ClosestHitDistSq = HitDistSq;
+
+				const FVector ImpactNormal = (AttackPoint - HitCapsulePoint).GetSafeNormal();
+				OutHit = FHitResult(Opponent, Opponent->GetMesh(), HitCapsulePoint + ImpactNormal * HitCapsule.Radius, ImpactNormal);
+				OutHit.TraceStart = AttackCapsule.Start;
+				OutHit.TraceEnd = AttackCapsule.End;
+				OutHit.BoneName = HitCapsule.Name;
+			}
+		}
+	}
+
+	UE_LOG(SVSLogDebug, Verbose, TEXT("Character: %s lag compensated sweep rewound %f seconds and %s"),
+		*GetName(), AttackRewindSeconds, ClosestHitDistSq < TNumericLimits<float>::Max() ? TEXT("hit") : TEXT("missed"));
+	return ClosestHitDistSq < TNumericLimits<float>::Max();
+}
+
+bool ASpyCharacter::GetActiveMontagePosition(const UAnimMontage*& OutMontage, float& OutPosition, float& OutPlayRate) const
+{
+	const UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
+	const UAnimMontage* ActiveMontage = IsValid(AnimInstance) ? AnimInstance->GetCurrentActiveMontage() : nullptr;
+	if (!IsValid(ActiveMontage))
+	{ return false; }
+
+	OutMontage = ActiveMontage;
+	OutPosition = AnimInstance->Montage_GetPosition(ActiveMontage);
+	OutPlayRate = AnimInstance->Montage_GetPlayRate(ActiveMontage);
+	return true;
+}
+
+bool ASpyCharacter::GetMontageSocketComponentTransform(const UAnimMontage* Montage, const float MontagePosition, const FName SocketName, FTransform& OutTransform) const
+{
+	const USkeletalMesh* SkeletalMesh = GetMesh()->GetSkeletalMeshAsset();
+	if (!IsValid(Montage) || !IsValid(SkeletalMesh) || !IsValid(SkeletalMesh->GetSkeleton()) || Montage->SlotAnimTracks.IsEmpty())
+	{ return false; }
+
+	const FAnimSegment* AnimSegment = Montage->SlotAnimTracks[0].AnimTrack.GetSegmentAtTime(MontagePosition);
+	const UAnimSequence* AnimSequence = AnimSegment ? Cast<UAnimSequence>(AnimSegment->GetAnimReference()) : nullptr;
+	if (!IsValid(AnimSequence))
+	{ return false; }
+	const float SequenceTime = AnimSegment->ConvertTrackPosToAnimPos(MontagePosition);
+
+	/** Sockets sit on a bone with an offset, plain bone names are accepted as well */
+	FName BoneName = SocketName;
+	FTransform SocketComponentTransform = FTransform::Identity;
+	if (const USkeletalMeshSocket* MeshSocket = SkeletalMesh->FindSocket(SocketName))
+	{
+		BoneName = MeshSocket->BoneName;
+		SocketComponentTransform = MeshSocket->GetSocketLocalTransform();
+	}
+
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+	int32 MeshBoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+	if (MeshBoneIndex == INDEX_NONE)
+	{ return false; }
+
+	/** Only the chain from the socket to the root is sampled, bones without a track keep their reference pose */
+	const USkeleton* Skeleton = SkeletalMesh->GetSkeleton();
+	const TArray<FTrackToSkeletonMap>& TrackToSkeletonMap = AnimSequence->GetCompressedTrackToSkeletonMapTable();
+	while (MeshBoneIndex != INDEX_NONE)
+	{
+		FTransform BoneLocalTransform = RefSkeleton.GetRefBonePose()[MeshBoneIndex];
+		/** Root motion moves the capsule rather than the mesh so the root keeps its reference pose */
+		const int32 SkeletonBoneIndex = Skeleton->GetSkeletonBoneIndexFromMeshBoneIndex(SkeletalMesh, MeshBoneIndex);
+		if (MeshBoneIndex > 0 &&
+			TrackToSkeletonMap.ContainsByPredicate([SkeletonBoneIndex](const FTrackToSkeletonMap& TrackMap)
+				{ return TrackMap.BoneTreeIndex == SkeletonBoneIndex; }))
+		{ AnimSequence->GetBoneTransform(BoneLocalTransform, FSkeletonPoseBoneIndex(SkeletonBoneIndex), SequenceTime, false); }
+
+		SocketComponentTransform = SocketComponentTransform * BoneLocalTransform;
+		MeshBoneIndex = RefSkeleton.GetParentIndex(MeshBoneIndex);
+	}
+
+	OutTransform = SocketComponentTransform;
+	return true;
+}
+
 void ASpyCharacter::PlayAttackAnimation(UAnimMontage* AttackMontage, const float TimerValue)
 {
 	if (IsRunningDedicatedServer())
@@ -709,11 +1004,17 @@ void ASpyCharacter::RequestPrimaryAttack(const FInputActionValue& Value)
 	if (GetLocalRole() == ROLE_SimulatedProxy || !IsValid(GetAbilitySystemComponent()))
 	{ return; }
 
-	S_RequestPrimaryAttack();
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	S_RequestPrimaryAttack(IsValid(GameState) ? GameState->GetServerWorldTimeSeconds() : 0.0);
 }
 
-void ASpyCharacter::S_RequestPrimaryAttack_Implementation()
+void ASpyCharacter::S_RequestPrimaryAttack_Implementation(const double InClientServerTime)
 {
+	/** Opponents on the attacking client are roughly one way trip behind its estimate of server time */
+	const double OneWayLatencySeconds = IsValid(GetPlayerState()) ? GetPlayerState()->GetPingInMilliseconds() * 0.0005 : 0.0;
+	const double ClientViewServerTime = InClientServerTime - OneWayLatencySeconds;
+	AttackRewindSeconds = FMath::Clamp(GetWorld()->GetTimeSeconds() - ClientViewServerTime, 0.0, static_cast<double>(MaxPoseRewindSeconds));
+	
 	SpyAbilitySystemComponent->TryActivateAbility(
 		SpyAbilitySystemComponent->FindAbilitySpecFromInputID(
 			static_cast<int32>(ESpyAbilityInputID::PrimaryAttackAction))->Handle);
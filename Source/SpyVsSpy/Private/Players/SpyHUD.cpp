@@ -4,6 +4,8 @@
 #include "Players/SpyHUD.h"
 
 #include "SVSLogger.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/GameUserSettings.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "UI/UIElementWidget.h"
@@ -67,8 +69,22 @@ void ASpyHUD::ConfirmGameUserSettings(const bool bOverrideCommandLine)
 void ASpyHUD::SetGameUIAssets(const TSoftObjectPtr<UUIElementAsset> InGameUIElementsAssets)
 {
 	checkfSlow(InGameUIElementsAssets, "PlayerHUD: Received Null UI Element Assets Soft Ptr");
-	const UUIElementAsset* UIElementAssets = InGameUIElementsAssets.LoadSynchronous();
-	checkfSlow(UIElementAssets, "PlayerHUD: Could not load UI Element Assets");
+	const UUIElementAsset* UIElementAssets = InGameUIElementsAssets.Get();
+
+	/** Never block the game thread, finish setting up once the asset is loaded */
+	if (!IsValid(UIElementAssets))
+	{
+		DisplayLoadingPlaceholder();
+		UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			InGameUIElementsAssets.ToSoftObjectPath(),
+			FStreamableDelegate::CreateWeakLambda(this, [this, InGameUIElementsAssets]()
+			{
+				HideLoadingPlaceholder();
+				if (InGameUIElementsAssets.IsValid())
+				{ SetGameUIAssets(InGameUIElementsAssets); }
+			}));
+		return;
+	}
 
 	// TODO Develop ENUM Iterator
 	/** Map Asset Settings to UI Element Types and Their Corresponding Slots */
@@ -82,25 +98,72 @@ void ASpyHUD::SetGameUIAssets(const TSoftObjectPtr<UUIElementAsset> InGameUIElem
 	LevelEndWidget = AddSlotUI_Implementation(UIElementAssets->GameWidgetClasses.GameEndScreenWidget.WidgetClass, EndSlotName);
 
 	DisplayUI();
+	ApplyPendingGameTime();
+}
+
+void ASpyHUD::ApplyPendingGameTime()
+{
+	if (PendingDisplayGameTime.IsSet())
+	{ ToggleDisplayGameTime(PendingDisplayGameTime.GetValue()); }
+	if (PendingMatchTimerSeconds.IsSet())
+	{ SetMatchTimerSeconds(PendingMatchTimerSeconds.GetValue()); }
+	if (PendingMatchStartCountDownTime.IsSet())
+	{
+		const float CountDownElapsed = GetWorld()->GetTimeSeconds() - PendingMatchStartCountDownRequestTime;
+		DisplayMatchStartCountDownTime(FMath::Max(PendingMatchStartCountDownTime.GetValue() - CountDownElapsed, 0.0f));
+	}
+}
+
+void ASpyHUD::DisplayLoadingPlaceholder()
+{
+	if (IsValid(LoadingPlaceholderWidget) || !IsValid(LoadingPlaceholderWidgetClass))
+	{ return; }
+
+	LoadingPlaceholderWidget = AddWidget(LoadingPlaceholderWidgetClass);
 }
 
-void ASpyHUD::ToggleDisplayGameTime(const bool bIsDisplayed) const
+void ASpyHUD::HideLoadingPlaceholder()
 {
-	check(GameLevelWidget)
+	if (!IsValid(LoadingPlaceholderWidget))
+	{ return; }
+
+	LoadingPlaceholderWidget->RemoveFromParent();
+	LoadingPlaceholderWidget = nullptr;
+}
+
+void ASpyHUD::ToggleDisplayGameTime(const bool bIsDisplayed)
+{
+	/** Game UI loads asynchronously so it may not exist yet, keep the request until it does */
+	if (!IsValid(GameLevelWidget))
+	{
+		PendingDisplayGameTime = bIsDisplayed;
+		return;
+	}
+	PendingDisplayGameTime.Reset();
 	bIsDisplayed ? GameLevelWidget->DisplayGameTimer() : GameLevelWidget->HideGameTimer();
 }
 
-void ASpyHUD::SetMatchTimerSeconds(const float InMatchTimerSeconds) const
+void ASpyHUD::SetMatchTimerSeconds(const float InMatchTimerSeconds)
 {
-	check(GameLevelWidget)
+	if (!IsValid(GameLevelWidget))
+	{
+		PendingMatchTimerSeconds = InMatchTimerSeconds;
+		return;
+	}
+	PendingMatchTimerSeconds.Reset();
 	GameLevelWidget->DisplayedMatchTime = FText::AsNumber(InMatchTimerSeconds, &FloatDisplayFormat);
 }
 
-void ASpyHUD::DisplayMatchStartCountDownTime(const float InMatchStartCountDownTime) const
+void ASpyHUD::DisplayMatchStartCountDownTime(const float InMatchStartCountDownTime)
 {
-	check(GameLevelWidget)
+	if (!IsValid(GameLevelWidget) || !IsValid(LevelMenuWidget))
+	{
+		PendingMatchStartCountDownTime = InMatchStartCountDownTime;
+		PendingMatchStartCountDownRequestTime = GetWorld()->GetTimeSeconds();
+		return;
+	}
+	PendingMatchStartCountDownTime.Reset();
 	GameLevelWidget->InitiateMatchStartTimer(InMatchStartCountDownTime);
-	check(LevelMenuWidget)
 	LevelMenuWidget->CloseGameMenu();
 }
 
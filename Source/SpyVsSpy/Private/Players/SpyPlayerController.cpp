@@ -8,6 +8,8 @@
 #include "EnhancedInput/Public/EnhancedInputComponent.h"
 #include "EnhancedInput/Public/EnhancedInputSubsystems.h"
 #include "EnhancedInput/Public/InputActionValue.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Players/SpyHUD.h"
 #include "Players/SpyPlayerState.h"
 #include "Players/SpyCharacter.h"
@@ -386,12 +388,27 @@ bool ASpyPlayerController::CanProcessRequest() const
 	return false;
 }
 
-void ASpyPlayerController::SetInputContext(const TSoftObjectPtr<UInputMappingContext> InMappingContext) const
+void ASpyPlayerController::SetInputContext(const TSoftObjectPtr<UInputMappingContext> InMappingContext)
+{
+	PendingInputMapping = InMappingContext;
+	if (InMappingContext.IsNull() || InMappingContext.IsValid())
+	{
+		ApplyPendingInputContext();
+		return;
+	}
+
+	/** Normally already loaded by the UI bootstrap, otherwise load without blocking the game thread */
+	UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		InMappingContext.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::ApplyPendingInputContext));
+}
+
+void ASpyPlayerController::ApplyPendingInputContext() const
 {
 	if(const ULocalPlayer* LocalPlayer = Cast<ULocalPlayer>(Player))
 	{
 		UEnhancedInputLocalPlayerSubsystem* InputSystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
-		if(const UInputMappingContext* InMappingContextLoaded = InMappingContext.LoadSynchronous())
+		if(const UInputMappingContext* InMappingContextLoaded = PendingInputMapping.Get())
 		{
 			InputSystem->ClearAllMappings();
 			InputSystem->AddMappingContext(InMappingContextLoaded, 0, FModifyContextOptions());
@@ -399,12 +416,54 @@ void ASpyPlayerController::SetInputContext(const TSoftObjectPtr<UInputMappingCon
 	}
 }
 
-void ASpyPlayerController::UpdateHUDWithGameUIElements(const ESVSGameType InGameType) const
+void ASpyPlayerController::UpdateHUDWithGameUIElements(const ESVSGameType InGameType)
 {
 	checkfSlow(GameElementsRegistry, "PlayerController: Verify Controller Blueprint has a UI Elements registry set");
 	if (InGameType == ESVSGameType::None) { return; }
+
+	const TSoftObjectPtr<UUIElementAsset>* GameUIElementsAsset = GameElementsRegistry->GameTypeUIMapping.Find(InGameType);
+	if (!GameUIElementsAsset)
+	{ return; }
 	
-	SpyPlayerHUD->SetGameUIAssets(GameElementsRegistry->GameTypeUIMapping.Find(InGameType)->LoadSynchronous());
+	/** The UI asset holds hard references to its widget classes so they are loaded along with it */
+	TArray<FSoftObjectPath> GameUIAssetPaths;
+	GameUIAssetPaths.Emplace(GameUIElementsAsset->ToSoftObjectPath());
+	if (!GameInputMapping.IsNull())
+	{ GameUIAssetPaths.Emplace(GameInputMapping.ToSoftObjectPath()); }
+	if (!MenuInputMapping.IsNull())
+	{ GameUIAssetPaths.Emplace(MenuInputMapping.ToSoftObjectPath()); }
+
+	/** A newer game type replaces any load still in flight */
+	if (GameUIAssetsLoadHandle.IsValid())
+	{ GameUIAssetsLoadHandle->CancelHandle(); }
+	GameUIAssetsLoadStartTime = FPlatformTime::Seconds();
+	GameUIAssetsLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		GameUIAssetPaths,
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnGameUIAssetsLoaded, InGameType),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	/** RequestAsyncLoad defers the delegate a frame even when everything is in memory, only show the placeholder for a real load */
+	if (GameUIAssetsLoadHandle.IsValid() && GameUIAssetsLoadHandle->IsLoadingInProgress())
+	{ SpyPlayerHUD->DisplayLoadingPlaceholder(); }
+}
+
+void ASpyPlayerController::OnGameUIAssetsLoaded(const ESVSGameType InGameType)
+{
+	GameUIAssetsLoadHandle.Reset();
+	
+	const TSoftObjectPtr<UUIElementAsset>* GameUIElementsAsset = GameElementsRegistry->GameTypeUIMapping.Find(InGameType);
+	if (!GameUIElementsAsset || !IsValid(SpyPlayerHUD))
+	{ return; }
+
+	UE_LOG(SVSLog, Log, TEXT("PlayerController loaded UI assets for game type: %s in %f seconds"),
+		*UEnum::GetValueAsString(InGameType),
+		FPlatformTime::Seconds() - GameUIAssetsLoadStartTime);
+	
+	SpyPlayerHUD->HideLoadingPlaceholder();
+	SpyPlayerHUD->SetGameUIAssets(*GameUIElementsAsset);
+
+	/** Apply an input context which was requested while its asset was still loading */
+	ApplyPendingInputContext();
 }
 
 void ASpyPlayerController::RequestDisplayLevelMenu()
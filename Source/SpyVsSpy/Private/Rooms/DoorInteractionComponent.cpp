@@ -11,6 +11,8 @@
 #include "Items/InventoryComponent.h"
 #include "Items/InventoryTrapAsset.h"
 #include "Rooms/SVSDynamicDoor.h"
+#include "GameFramework/PlayerController.h"
+#include "Players/SpyCharacter.h"
 
 // Sets default values for this component's properties
 UDoorInteractionComponent::UDoorInteractionComponent()
@@ -66,12 +68,12 @@ bool UDoorInteractionComponent::Interact_Implementation(AActor* InteractRequeste
 			}
 		case EDoorState::Closed:
 			{
-				NM_OpenDoor();
+				NM_OpenDoor(InteractRequester);
 				return true;
 			}
 		case EDoorState::Closing:
 			{
-				NM_OpenDoor();
+				NM_OpenDoor(InteractRequester);
 				return true;
 			}
 		case EDoorState::Locked:
@@ -106,9 +108,44 @@ void UDoorInteractionComponent::SetInteractionEnabled(const bool bIsEnabled)
 		{ UE_LOG(SVSLog, Warning, TEXT("Door Interaction Component could not get owner as a svsdynamicdoor")); }
 		
 		DoorState = EDoorState::Closed;
+		UpdateDoorTraversable();
 		return;
 	}
 	DoorState = EDoorState::Disabled;
+	UpdateDoorTraversable();
+}
+
+void UDoorInteractionComponent::SetDoorLocked(const bool bLocked)
+{
+	if (!GetOwner()->HasAuthority() ||
+		DoorState == EDoorState::Disabled ||
+		(DoorState == EDoorState::Locked) == bLocked)
+	{ return; }
+
+	NM_SetDoorLocked(bLocked);
+}
+
+void UDoorInteractionComponent::NM_SetDoorLocked_Implementation(const bool bLocked)
+{
+	if (DoorState == EDoorState::Disabled || (DoorState == EDoorState::Locked) == bLocked)
+	{ return; }
+	
+	if (bLocked)
+	{
+		DoorTransitionTimeline->Stop();
+		TransitionDoor(0.0f);
+	}
+	DoorState = bLocked ? EDoorState::Locked : EDoorState::Closed;
+	UpdateDoorTraversable();
+}
+
+void UDoorInteractionComponent::UpdateDoorTraversable()
+{
+	if (bBroadcastTraversable == IsTraversable())
+	{ return; }
+
+	bBroadcastTraversable = IsTraversable();
+	OnDoorTraversableChanged.Broadcast(this, bBroadcastTraversable);
 }
 
 UInventoryTrapAsset* UDoorInteractionComponent::GetActiveTrap_Implementation()
@@ -154,10 +191,19 @@ bool UDoorInteractionComponent::SetActiveTrap_Implementation(UInventoryTrapAsset
 	return false;
 }
 
-void UDoorInteractionComponent::NM_OpenDoor_Implementation()
+void UDoorInteractionComponent::NM_OpenDoor_Implementation(const AActor* InOpener)
 {
 	if (IsValid(DoorOpenSfx))
 	{ DoorOpenSfx->Play(); }
+
+	/** Only prewarm doors the local player opened or which lead out of the local player's room */
+	const ASVSDynamicDoor* Door = GetOwner<ASVSDynamicDoor>();
+	const APlayerController* LocalPlayerController = GetWorld()->GetFirstPlayerController();
+	const ASpyCharacter* LocalSpyCharacter = IsValid(LocalPlayerController) ? LocalPlayerController->GetPawn<ASpyCharacter>() : nullptr;
+	if (IsValid(Door) &&
+		IsValid(LocalSpyCharacter) &&
+		(InOpener == LocalSpyCharacter || Door->IsDoorOfRoom(LocalSpyCharacter->GetCurrentRoom())))
+	{ Door->PrewarmAdjacentRooms(); }
 	
 	DoorState = EDoorState::Opening;
 	DoorTransitionTimeline->PlayFromStart();
@@ -220,5 +266,9 @@ void UDoorInteractionComponent::EnableInteractionVisualAid_Implementation(const
 	{
 		Door->GetStaticMeshComponent()->SetRenderCustomDepth(bEnabled);
 		Door->GetStaticMeshComponent()->SetCustomDepthStencilValue(bEnabled ? 2 : 0);
+
+		/** Visual aid is only enabled for the local player approaching the door */
+		if (bEnabled)
+		{ Door->PrewarmAdjacentRooms(); }
 	}
 }
\ No newline at end of file
@@ -3,17 +3,49 @@
 
 #include "Rooms/RoomManager.h"
 
+#include "SVSLogger.h"
+#include "SpyVsSpy/SpyVsSpy.h"
+#include "Components/AudioComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/GameModeBase.h"
 #include "Rooms/SVSRoom.h"
+#include "Rooms/SVSDynamicDoor.h"
+#include "Rooms/DoorInteractionComponent.h"
+#include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
 #include "Misc/Guid.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Players/SpyCharacter.h"
+#include "Players/SpyPlayerState.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Room Actors"), STAT_SVSDormantRoomActors, STATGROUP_SpyVsSpy);
+DECLARE_CYCLE_STAT(TEXT("Find Respawn Location"), STAT_SVSFindRespawnLocation, STATGROUP_SpyVsSpy);
 
 // Sets default values
 ARoomManager::ARoomManager()
 {
  	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = false;
+
+	/** Clients need the room index for occupancy tracking so the manager is available everywhere */
+	bReplicates = true;
+	bAlwaysRelevant = true;
+}
+
+void ARoomManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams SharedParamsRepNotifyChanged;
+	SharedParamsRepNotifyChanged.bIsPushBased = true;
+	SharedParamsRepNotifyChanged.RepNotifyCondition = REPNOTIFY_OnChanged;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RoomOccupancyBits, SharedParamsRepNotifyChanged);
 }
 
 void ARoomManager::GetRoomListingCollection(TArray<FRoomListing>& RoomListingCollection, const bool bGetOccupiedRooms)
@@ -33,42 +65,929 @@ void ARoomManager::BeginPlay()
 {
 	Super::BeginPlay();
 
-	/** Run only on server if network game */
-	if (!HasAuthority()) { return; }
-
-	/** Collect all Room Actor References and update them with a reference to this manager */
+	/** Collect all Room Actor References and update them with a reference to this manager
+	 * Rooms are placed in the level so clients can build the same index */
 	TArray<AActor*> RoomActors;
 	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASVSRoom::StaticClass(), RoomActors);
 	for (AActor* RoomActor : RoomActors)
 	{
 		if (ASVSRoom* Room = Cast<ASVSRoom>(RoomActor))
 		{
-			AddRoom(Room, Room->GetRoomGuid());
+			RegisterRoom(Room, Room->GetRoomGuid());
 			Room->RoomManager = this;
+			/** Rooms no longer need their own triggers when the manager tracks occupancy */
+			if (bEnableOccupancyTracking)
+			{ Room->SetOccupancyTriggerEnabled(false); }
 		}
 	}
+	RebuildRoomIndex();
+
+	/** Room visuals are local so a dedicated server never animates rooms */
+	if (RoomTransitionMode == ERoomTransitionMode::ParameterCollection && !IsRunningDedicatedServer())
+	{ InitRoomTransitionSlots(); }
+
+	/** Clients, listen server hosts and standalone players render rooms, dedicated servers have no local players */
+	if (bEnableRoomSignificance && !IsRunningDedicatedServer())
+	{
+		GetWorldTimerManager().SetTimer(
+			RoomSignificanceTimerHandle,
+			this,
+			&ThisClass::EvaluateRoomSignificance,
+			RoomSignificanceInterval,
+			true);
+	}
+
+	/** Server samples for authoritative occupancy and clients sample to drive local room visuals */
+	if (bEnableOccupancyTracking)
+	{
+		GetWorldTimerManager().SetTimer(
+			OccupancySampleTimerHandle,
+			this,
+			&ThisClass::SampleRoomOccupancy,
+			OccupancySampleInterval,
+			true);
+	}
 }
 
-void ARoomManager::AddRoom_Implementation(ASVSRoom* InDynamicRoom, const FGuid InRoomGuid)
+void ARoomManager::AddRoom(ASVSRoom* InDynamicRoom, const FGuid InRoomGuid)
 {
-	if (!IsValid(InDynamicRoom) || !HasAuthority()) { return; }
-	
-	const FRoomListing RoomListing = FRoomListing(InDynamicRoom, InRoomGuid, false);
-	RoomCollection.Emplace(RoomListing);
+	if (!HasAuthority()) { return; }
+
+	/** Rooms may register themselves after the manager has already collected them,
+	 * rooms registering in the same frame share one rebuild rather than re-indexing once per room */
+	if (RegisterRoom(InDynamicRoom, InRoomGuid) && !bRoomIndexRebuildPending)
+	{
+		bRoomIndexRebuildPending = true;
+		GetWorldTimerManager().SetTimerForNextTick(this, &ThisClass::RebuildPendingRoomIndex);
+	}
 }
 
-void ARoomManager::SetRoomOccupied_Implementation(const ASVSRoom* InRoom, const bool bIsOccupied, const ASpyCharacter* PlayerCharacter)
+void ARoomManager::RebuildPendingRoomIndex()
+{
+	if (!bRoomIndexRebuildPending)
+	{ return; }
+	bRoomIndexRebuildPending = false;
+	RebuildRoomIndex();
+}
+
+void ARoomManager::SetRoomOccupied(const ASVSRoom* InRoom, const bool bIsOccupied, const ASpyCharacter* PlayerCharacter)
 {
 	if (!IsValid(InRoom) || RoomCollection.Num() == 0 || !HasAuthority()) { return; }
 	
 	OnRoomOccupied.Broadcast(InRoom, PlayerCharacter, bIsOccupied);
+
+	const int32 RoomIndex = GetRoomListingIndex(InRoom);
+	if (RoomIndex == INDEX_NONE)
+	{ return; }
+
+	/** Another character may still be in the room after this one exits */
+	const bool bRoomOccupied = bIsOccupied || InRoom->GetNumOccupyingSpyCharacters() > 0;
+	if (RoomCollection[RoomIndex].bIsOccupied == bRoomOccupied)
+	{ return; }
+	
+	RoomCollection[RoomIndex].bIsOccupied = bRoomOccupied;
+	const int32 ByteIndex = RoomIndex / 8;
+	if (!RoomOccupancyBits.IsValidIndex(ByteIndex))
+	{ RoomOccupancyBits.SetNumZeroed(ByteIndex + 1); }
+	if (bRoomOccupied)
+	{ RoomOccupancyBits[ByteIndex] |= 1 << (RoomIndex % 8); }
+	else
+	{ RoomOccupancyBits[ByteIndex] &= ~(1 << (RoomIndex % 8)); }
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RoomOccupancyBits, this);
+	
+	OnRoomOccupancyChanged.Broadcast(InRoom, bRoomOccupied);
+}
+
+bool ARoomManager::IsRoomOccupied(const ASVSRoom* InRoom) const
+{
+	const int32 RoomIndex = GetRoomListingIndex(InRoom);
+	return RoomIndex != INDEX_NONE && RoomCollection[RoomIndex].bIsOccupied;
+}
+
+#pragma region="RoomIndex"
+ASVSRoom* ARoomManager::FindRoomAtLocation(const FVector& InLocation) const
+{
+	const int32 RoomIndex = FindRoomListingIndexAtLocation(InLocation);
+	return RoomIndex != INDEX_NONE ? RoomCollection[RoomIndex].Room : nullptr;
+}
+
+ASVSRoom* ARoomManager::FindRoomByGuid(const FGuid& InRoomGuid) const
+{
+	const int32* RoomIndex = RoomGuidIndex.Find(InRoomGuid);
+	return RoomIndex ? RoomCollection[*RoomIndex].Room : nullptr;
+}
+
+ASVSRoom* ARoomManager::GetRoomByIndex(const int32 InRoomIndex) const
+{
+	return RoomCollection.IsValidIndex(InRoomIndex) ? RoomCollection[InRoomIndex].Room : nullptr;
+}
+
+int32 ARoomManager::GetRoomListingIndex(const ASVSRoom* InRoom) const
+{
+	if (!IsValid(InRoom))
+	{ return INDEX_NONE; }
+
+	/** Rooms carry their index so no lookup is needed, only confirm the room is the one indexed here */
+	const int32 RoomIndex = InRoom->GetRoomIndex();
+	return RoomCollection.IsValidIndex(RoomIndex) && RoomCollection[RoomIndex].Room == InRoom ? RoomIndex : INDEX_NONE;
+}
+
+bool ARoomManager::RegisterRoom(ASVSRoom* InRoom, const FGuid& InRoomGuid)
+{
+	if (!IsValid(InRoom) ||
+		RoomCollection.ContainsByPredicate([InRoom](const FRoomListing& RoomListing) { return RoomListing.Room == InRoom; }))
+	{ return false; }
+
+	RoomCollection.Emplace(FRoomListing(InRoom, InRoomGuid, false));
+	return true;
+}
+
+void ARoomManager::RebuildRoomIndex()
+{
+	bRoomIndexRebuildPending = false;
+	RoomGridIndex.Reset();
+	RoomGuidIndex.Reset();
+	RoomGridCellSize = 0.0f;
+
+	/**
+	 * Server and clients collect rooms in any order, sort by level name so room indices match across the network
+	 * Level names are fixed when the level is saved so the index only changes when rooms are added or removed
+	 */
+	RoomCollection.RemoveAll([](const FRoomListing& RoomListing) { return !IsValid(RoomListing.Room); });
+	RoomCollection.Sort([](const FRoomListing& A, const FRoomListing& B)
+	{
+		return A.Room->GetPathName() < B.Room->GetPathName();
+	});
+	if (RoomCollection.Num() >= ASVSRoom::InvalidRoomIndex)
+	{
+		UE_LOG(SVSLog, Warning, TEXT("RoomManager has %i rooms, only the first %i are indexed"),
+			RoomCollection.Num(), ASVSRoom::InvalidRoomIndex);
+		RoomCollection.SetNum(ASVSRoom::InvalidRoomIndex);
+	}
+
+	/** Room location is the centre of the floor and room scale is the full size of the room */
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
+	{
+		FRoomListing& RoomListing = RoomCollection[RoomIndex];
+		RoomListing.Room->SetRoomIndex(static_cast<uint16>(RoomIndex));
+		if (RoomListing.RoomGuid.IsValid())
+		{ RoomGuidIndex.Emplace(RoomListing.RoomGuid, RoomIndex); }
+		
+		const FVector RoomLocation = RoomListing.Room->Execute_GetRoomLocation(RoomListing.Room);
+		const FVector RoomHalfScale = IRoomInterface::Execute_GetRoomScale(RoomListing.Room) * 0.5f;
+		RoomListing.RoomBounds = FBox2D(
+			FVector2D(RoomLocation.X - RoomHalfScale.X, RoomLocation.Y - RoomHalfScale.Y),
+			FVector2D(RoomLocation.X + RoomHalfScale.X, RoomLocation.Y + RoomHalfScale.Y));
+		RoomListing.RoomFloorHeight = RoomLocation.Z;
+
+		const FVector2D RoomSize = RoomListing.RoomBounds.GetSize();
+		const float SmallestRoomSide = FMath::Min(RoomSize.X, RoomSize.Y);
+		if (SmallestRoomSide > UE_KINDA_SMALL_NUMBER &&
+			(RoomGridCellSize <= 0.0f || SmallestRoomSide < RoomGridCellSize))
+		{ RoomGridCellSize = SmallestRoomSide; }
+	}
+
+	if (RoomGridCellSize <= 0.0f)
+	{
+		UE_LOG(SVSLog, Warning, TEXT("RoomManager could not build room index as no rooms have a valid size"));
+		return;
+	}
+
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
+	{
+		const FRoomListing& RoomListing = RoomCollection[RoomIndex];
+
+		/** Register the room with every cell its floor plan overlaps */
+		const FIntPoint MinCell = GetRoomGridCell(RoomListing.RoomBounds.Min);
+		const FIntPoint MaxCell = GetRoomGridCell(RoomListing.RoomBounds.Max);
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+		{
+			for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+			{ RoomGridIndex.FindOrAdd(FIntPoint(CellX, CellY)).Emplace(RoomIndex); }
+		}
+	}
+	
+	UE_LOG(SVSLogDebug, Log, TEXT("RoomManager indexed %i rooms into %i cells of size %f"),
+		RoomCollection.Num(), RoomGridIndex.Num(), RoomGridCellSize);
+
+	CollectRoomDoors();
+
+	if (HasAuthority())
+	{
+		WriteRoomOccupancyBits();
+		BuildRoomSpawnPoints();
+	}
+	else
+	{ ApplyRoomOccupancyBits(); }
+}
+
+void ARoomManager::CollectRoomDoors()
+{
+	for (const FRoomDoorListing& DoorListing : RoomDoorCollection)
+	{
+		if (IsValid(DoorListing.Door) && IsValid(DoorListing.Door->GetDoorInteractionComponent()))
+		{ DoorListing.Door->GetDoorInteractionComponent()->OnDoorTraversableChanged.RemoveAll(this); }
+	}
+	RoomDoorCollection.Reset();
+	for (TActorIterator<ASVSDynamicDoor> DoorIterator(GetWorld()); DoorIterator; ++DoorIterator)
+	{
+		const int32 RoomIndexA = GetRoomListingIndex(Cast<ASVSRoom>(DoorIterator->RoomA));
+		const int32 RoomIndexB = GetRoomListingIndex(Cast<ASVSRoom>(DoorIterator->RoomB));
+		if (RoomIndexA == INDEX_NONE || RoomIndexB == INDEX_NONE)
+		{ continue; }
+
+		FRoomDoorListing DoorListing;
+		DoorListing.Door = *DoorIterator;
+		DoorListing.RoomIndexA = RoomIndexA;
+		DoorListing.RoomIndexB = RoomIndexB;
+		if (UDoorInteractionComponent* DoorInteractionComponent = DoorIterator->GetDoorInteractionComponent())
+		{
+			DoorListing.bIsTraversable = DoorInteractionComponent->IsTraversable();
+			DoorInteractionComponent->OnDoorTraversableChanged.AddUObject(
+				this,
+				&ThisClass::OnRoomDoorTraversableChanged,
+				RoomDoorCollection.Num());
+		}
+		RoomDoorCollection.Emplace(DoorListing);
+	}
+
+	BuildRoomGraph();
+}
+
+int32 ARoomManager::FindRoomListingIndexAtLocation(const FVector& InLocation) const
+{
+	if (RoomGridCellSize <= 0.0f)
+	{ return INDEX_NONE; }
+
+	const TArray<int32, TInlineAllocator<4>>* CellRoomIndices = RoomGridIndex.Find(GetRoomGridCell(FVector2D(InLocation)));
+	if (!CellRoomIndices)
+	{ return INDEX_NONE; }
+
+	/** Stacked rooms share a floor plan so prefer the room with the closest floor */
+	int32 FoundRoomIndex = INDEX_NONE;
+	float FoundFloorDistance = TNumericLimits<float>::Max();
+	for (const int32 RoomIndex : *CellRoomIndices)
+	{
+		const FRoomListing& RoomListing = RoomCollection[RoomIndex];
+		if (!RoomListing.RoomBounds.IsInside(FVector2D(InLocation)))
+		{ continue; }
+
+		const float FloorDistance = FMath::Abs(InLocation.Z - RoomListing.RoomFloorHeight);
+		if (FloorDistance < FoundFloorDistance)
+		{
+			FoundRoomIndex = RoomIndex;
+			FoundFloorDistance = FloorDistance;
+		}
+	}
+	return FoundRoomIndex;
+}
+
+FIntPoint ARoomManager::GetRoomGridCell(const FVector2D& InLocation) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(InLocation.X / RoomGridCellSize),
+		FMath::FloorToInt32(InLocation.Y / RoomGridCellSize));
+}
+#pragma endregion="RoomIndex"
+
+#pragma region="RoomGraph"
+void ARoomManager::BuildRoomGraph()
+{
+	/** Count doors per room, then lay out each room's neighbours contiguously */
+	RoomGraphOffsets.Init(0, RoomCollection.Num() + 1);
+	for (const FRoomDoorListing& DoorListing : RoomDoorCollection)
+	{
+		if (DoorListing.RoomIndexA == DoorListing.RoomIndexB)
+		{ continue; }
+		RoomGraphOffsets[DoorListing.RoomIndexA + 1]++;
+		RoomGraphOffsets[DoorListing.RoomIndexB + 1]++;
+	}
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
+	{ RoomGraphOffsets[RoomIndex + 1] += RoomGraphOffsets[RoomIndex]; }
+
+	const int32 NumEdges = RoomGraphOffsets.Last();
+	RoomGraphNeighbours.SetNumUninitialized(NumEdges);
+	RoomGraphEdgeDoors.SetNumUninitialized(NumEdges);
+	TArray<int32> RoomEdgeCursors(RoomGraphOffsets.GetData(), RoomCollection.Num());
+	for (int32 DoorIndex = 0; DoorIndex < RoomDoorCollection.Num(); DoorIndex++)
+	{
+		const FRoomDoorListing& DoorListing = RoomDoorCollection[DoorIndex];
+		if (DoorListing.RoomIndexA == DoorListing.RoomIndexB)
+		{ continue; }
+
+		const int32 EdgeIndexA = RoomEdgeCursors[DoorListing.RoomIndexA]++;
+		RoomGraphNeighbours[EdgeIndexA] = DoorListing.RoomIndexB;
+		RoomGraphEdgeDoors[EdgeIndexA] = DoorIndex;
+		const int32 EdgeIndexB = RoomEdgeCursors[DoorListing.RoomIndexB]++;
+		RoomGraphNeighbours[EdgeIndexB] = DoorListing.RoomIndexA;
+		RoomGraphEdgeDoors[EdgeIndexB] = DoorIndex;
+	}
+
+	RoomDistanceRows.Reset();
+	RoomDistanceRows.SetNum(RoomCollection.Num());
+	
+	UE_LOG(SVSLogDebug, Log, TEXT("RoomManager built room graph of %i rooms and %i doors"),
+		RoomCollection.Num(), NumEdges / 2);
+}
+
+void ARoomManager::ComputeRoomDistanceRow(const int32 InSourceRoomIndex) const
+{
+	TArray<uint16>& DistanceRow = RoomDistanceRows[InSourceRoomIndex];
+	DistanceRow.Init(UnreachableRoomDistance, RoomCollection.Num());
+	DistanceRow[InSourceRoomIndex] = 0;
+
+	RoomGraphSearchQueue.Reset();
+	RoomGraphSearchQueue.Emplace(InSourceRoomIndex);
+	for (int32 QueueIndex = 0; QueueIndex < RoomGraphSearchQueue.Num(); QueueIndex++)
+	{
+		const int32 RoomIndex = RoomGraphSearchQueue[QueueIndex];
+		for (int32 EdgeIndex = RoomGraphOffsets[RoomIndex]; EdgeIndex < RoomGraphOffsets[RoomIndex + 1]; EdgeIndex++)
+		{
+			const int32 NeighbourRoomIndex = RoomGraphNeighbours[EdgeIndex];
+			if (DistanceRow[NeighbourRoomIndex] != UnreachableRoomDistance ||
+				!RoomDoorCollection[RoomGraphEdgeDoors[EdgeIndex]].bIsTraversable)
+			{ continue; }
+
+			DistanceRow[NeighbourRoomIndex] = DistanceRow[RoomIndex] + 1;
+			RoomGraphSearchQueue.Emplace(NeighbourRoomIndex);
+		}
+	}
+}
+
+const TArray<uint16>& ARoomManager::GetRoomDistanceRow(const int32 InRoomIndex) const
+{
+	static const TArray<uint16> EmptyDistanceRow;
+	if (!RoomDistanceRows.IsValidIndex(InRoomIndex))
+	{ return EmptyDistanceRow; }
+
+	if (RoomDistanceRows[InRoomIndex].Num() == 0)
+	{ ComputeRoomDistanceRow(InRoomIndex); }
+	return RoomDistanceRows[InRoomIndex];
+}
+
+int32 ARoomManager::GetRoomDistance(const ASVSRoom* InFromRoom, const ASVSRoom* InToRoom) const
+{
+	const int32 FromRoomIndex = GetRoomListingIndex(InFromRoom);
+	const int32 ToRoomIndex = GetRoomListingIndex(InToRoom);
+	if (FromRoomIndex == INDEX_NONE || ToRoomIndex == INDEX_NONE)
+	{ return INDEX_NONE; }
+
+	const uint16 Distance = GetRoomDistanceRow(FromRoomIndex)[ToRoomIndex];
+	return Distance != UnreachableRoomDistance ? Distance : INDEX_NONE;
+}
+
+bool ARoomManager::FindRoomPath(const ASVSRoom* InFromRoom, const ASVSRoom* InToRoom, TArray<ASVSRoom*>& OutRoomPath) const
+{
+	OutRoomPath.Reset();
+	const int32 FromRoomIndex = GetRoomListingIndex(InFromRoom);
+	const int32 ToRoomIndex = GetRoomListingIndex(InToRoom);
+	if (FromRoomIndex == INDEX_NONE || ToRoomIndex == INDEX_NONE)
+	{ return false; }
+
+	/** Distances to the destination lead downhill from the start, one door at a time */
+	const TArray<uint16>& DistanceRow = GetRoomDistanceRow(ToRoomIndex);
+	if (DistanceRow[FromRoomIndex] == UnreachableRoomDistance)
+	{ return false; }
+
+	OutRoomPath.Reserve(DistanceRow[FromRoomIndex] + 1);
+	int32 RoomIndex = FromRoomIndex;
+	OutRoomPath.Emplace(RoomCollection[RoomIndex].Room);
+	while (RoomIndex != ToRoomIndex)
+	{
+		int32 NextRoomIndex = INDEX_NONE;
+		for (int32 EdgeIndex = RoomGraphOffsets[RoomIndex]; EdgeIndex < RoomGraphOffsets[RoomIndex + 1]; EdgeIndex++)
+		{
+			const int32 NeighbourRoomIndex = RoomGraphNeighbours[EdgeIndex];
+			if (DistanceRow[NeighbourRoomIndex] + 1 == DistanceRow[RoomIndex] &&
+				RoomDoorCollection[RoomGraphEdgeDoors[EdgeIndex]].bIsTraversable)
+			{
+				NextRoomIndex = NeighbourRoomIndex;
+				break;
+			}
+		}
+		if (NextRoomIndex == INDEX_NONE)
+		{
+			OutRoomPath.Reset();
+			return false;
+		}
+		RoomIndex = NextRoomIndex;
+		OutRoomPath.Emplace(RoomCollection[RoomIndex].Room);
+	}
+	return true;
+}
+
+void ARoomManager::GetRoomsWithinHops(const ASVSRoom* InFromRoom, const int32 InMaxHops, TArray<ASVSRoom*>& OutRooms) const
+{
+	const int32 FromRoomIndex = GetRoomListingIndex(InFromRoom);
+	if (FromRoomIndex == INDEX_NONE || InMaxHops < 0)
+	{ return; }
+
+	const TArray<uint16>& DistanceRow = GetRoomDistanceRow(FromRoomIndex);
+	for (int32 RoomIndex = 0; RoomIndex < DistanceRow.Num(); RoomIndex++)
+	{
+		if (DistanceRow[RoomIndex] <= InMaxHops)
+		{ OutRooms.Emplace(RoomCollection[RoomIndex].Room); }
+	}
+}
+
+void ARoomManager::OnRoomDoorTraversableChanged(const UDoorInteractionComponent* InDoorInteractionComponent, const bool bIsTraversable, const int32 InDoorIndex)
+{
+	if (!RoomDoorCollection.IsValidIndex(InDoorIndex) || RoomDoorCollection[InDoorIndex].bIsTraversable == bIsTraversable)
+	{ return; }
+
+	FRoomDoorListing& DoorListing = RoomDoorCollection[InDoorIndex];
+	DoorListing.bIsTraversable = bIsTraversable;
+
+	/**
+	 * A closing door only changes distances from sources where it sits on a shortest route, its rooms are one hop apart
+	 * An opening door only changes distances from sources where it offers a shortcut, its rooms are more than one hop apart
+	 */
+	int32 NumInvalidatedRows = 0;
+	for (TArray<uint16>& DistanceRow : RoomDistanceRows)
+	{
+		if (DistanceRow.Num() == 0)
+		{ continue; }
+
+		const int32 DistanceDifference = FMath::Abs(
+			static_cast<int32>(DistanceRow[DoorListing.RoomIndexA]) - static_cast<int32>(DistanceRow[DoorListing.RoomIndexB]));
+		if (bIsTraversable ? DistanceDifference > 1 : DistanceDifference == 1)
+		{
+			DistanceRow.Reset();
+			NumInvalidatedRows++;
+		}
+	}
+	
+	UE_LOG(SVSLogDebug, Log, TEXT("RoomManager door %s is %s, invalidated %i room distance rows"),
+		*GetNameSafe(DoorListing.Door), bIsTraversable ? TEXT("traversable") : TEXT("blocked"), NumInvalidatedRows);
+}
+#pragma endregion="RoomGraph"
+
+#pragma region="Respawn"
+void ARoomManager::BuildRoomSpawnPoints()
+{
+	/** Size candidates for the pawn players will respawn as */
+	FVector2D SpawnCapsuleSize = DefaultSpawnCapsuleSize;
+	if (const AGameModeBase* GameMode = GetWorld()->GetAuthGameMode())
+	{
+		const ACharacter* DefaultCharacter = GameMode->DefaultPawnClass ?
+			Cast<ACharacter>(GameMode->DefaultPawnClass->GetDefaultObject()) : nullptr;
+		if (IsValid(DefaultCharacter) && IsValid(DefaultCharacter->GetCapsuleComponent()))
+		{
+			SpawnCapsuleSize = FVector2D(
+				DefaultCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius(),
+				DefaultCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
+		}
+	}
+	const FCollisionShape SpawnCapsule = FCollisionShape::MakeCapsule(SpawnCapsuleSize.X, SpawnCapsuleSize.Y);
+	const FCollisionQueryParams SpawnQueryParams(SCENE_QUERY_STAT(SVSRoomSpawnPoint), false, this);
+
+	RoomSpawnPointOffsets.Init(0, RoomCollection.Num() + 1);
+	RoomSpawnPoints.Reset();
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
+	{
+		const FRoomListing& RoomListing = RoomCollection[RoomIndex];
+		const FBox2D SpawnBounds = RoomListing.RoomBounds.ExpandBy(-(SpawnPointWallMargin + SpawnCapsuleSize.X));
+		if (SpawnBounds.bIsValid && SpawnBounds.Min.X < SpawnBounds.Max.X && SpawnBounds.Min.Y < SpawnBounds.Max.Y)
+		{
+			/** Lift the capsule clear of the floor so only furniture and walls block it */
+			const float SpawnHeight = RoomListing.RoomFloorHeight + SpawnCapsuleSize.Y + 2.0f;
+			for (int32 PointX = 0; PointX < SpawnPointsPerRoomAxis; PointX++)
+			{
+				for (int32 PointY = 0; PointY < SpawnPointsPerRoomAxis; PointY++)
+				{
+					const FVector2D PointAlpha(
+						(PointX + 0.5f) / SpawnPointsPerRoomAxis,
+						(PointY + 0.5f) / SpawnPointsPerRoomAxis);
+					const FVector SpawnPoint(
+						FMath::Lerp(SpawnBounds.Min.X, SpawnBounds.Max.X, PointAlpha.X),
+						FMath::Lerp(SpawnBounds.Min.Y, SpawnBounds.Max.Y, PointAlpha.Y),
+						SpawnHeight);
+					if (!GetWorld()->OverlapBlockingTestByChannel(
+						SpawnPoint, FQuat::Identity, ECC_Pawn, SpawnCapsule, SpawnQueryParams))
+					{ RoomSpawnPoints.Emplace(SpawnPoint); }
+				}
+			}
+		}
+		RoomSpawnPointOffsets[RoomIndex + 1] = RoomSpawnPoints.Num();
+	}
+
+	if (RecentDeaths.Num() != RecentDeathHistorySize)
+	{
+		RecentDeaths.Init(FRoomRecentDeath(), RecentDeathHistorySize);
+		RecentDeathCursor = 0;
+	}
 	
-	for (int32 Index = 0; Index < RoomCollection.Num(); Index++)
+	UE_LOG(SVSLogDebug, Log, TEXT("RoomManager validated %i spawn points across %i rooms"),
+		RoomSpawnPoints.Num(), RoomCollection.Num());
+}
+
+void ARoomManager::RecordSpyDeath(const FVector& InDeathLocation)
+{
+	if (!HasAuthority() || RecentDeaths.Num() == 0)
+	{ return; }
+
+	FRoomRecentDeath& RecentDeath = RecentDeaths[RecentDeathCursor];
+	RecentDeath.RoomIndex = FindRoomListingIndexAtLocation(InDeathLocation);
+	RecentDeath.DeathTime = GetWorld()->GetTimeSeconds();
+	RecentDeathCursor = (RecentDeathCursor + 1) % RecentDeaths.Num();
+}
+
+bool ARoomManager::FindRespawnLocation(const ASpyCharacter* InRespawningCharacter, FVector& OutRespawnLocation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SVSFindRespawnLocation);
+	
+	if (!HasAuthority() || RoomSpawnPointOffsets.Num() != RoomCollection.Num() + 1)
+	{ return false; }
+
+	/** Distance rows from the rooms of living opponents, rows are cached by the room graph */
+	TArray<const TArray<uint16>*, TInlineAllocator<8>> OpponentDistanceRows;
+	const ASpyPlayerState* RespawningPlayerState = IsValid(InRespawningCharacter) ?
+		InRespawningCharacter->GetPlayerState<ASpyPlayerState>() : nullptr;
+	const EPlayerTeam RespawningTeam = IsValid(RespawningPlayerState) ? RespawningPlayerState->GetSpyPlayerTeam() : EPlayerTeam::None;
+	if (const AGameStateBase* GameState = GetWorld()->GetGameState())
+	{
+		for (const APlayerState* PlayerState : GameState->PlayerArray)
+		{
+			const ASpyPlayerState* SpyPlayerState = Cast<ASpyPlayerState>(PlayerState);
+			const ASpyCharacter* Opponent = IsValid(SpyPlayerState) ? SpyPlayerState->GetPawn<ASpyCharacter>() : nullptr;
+			if (!IsValid(Opponent) || Opponent == InRespawningCharacter || !SpyPlayerState->IsAlive())
+			{ continue; }
+
+			/** Teammates are not a threat, spies without a team treat everyone as an opponent */
+			if (RespawningTeam != EPlayerTeam::None && SpyPlayerState->GetSpyPlayerTeam() == RespawningTeam)
+			{ continue; }
+
+			const int32 OpponentRoomIndex = FindRoomListingIndexAtLocation(Opponent->GetActorLocation());
+			if (OpponentRoomIndex != INDEX_NONE)
+			{ OpponentDistanceRows.Emplace(&GetRoomDistanceRow(OpponentRoomIndex)); }
+		}
+	}
+
+	const float TimeSeconds = GetWorld()->GetTimeSeconds();
+	int32 BestRoomIndex = INDEX_NONE;
+	float BestRoomScore = TNumericLimits<float>::Lowest();
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
 	{
-		if (RoomCollection[Index].Room == InRoom)
+		if (RoomCollection[RoomIndex].bIsOccupied ||
+			RoomSpawnPointOffsets[RoomIndex] == RoomSpawnPointOffsets[RoomIndex + 1])
+		{ continue; }
+
+		/** Unreachable opponents count as far away */
+		int32 OpponentHops = RespawnSafeHops;
+		for (const TArray<uint16>* OpponentDistanceRow : OpponentDistanceRows)
+		{ OpponentHops = FMath::Min(OpponentHops, static_cast<int32>((*OpponentDistanceRow)[RoomIndex])); }
+
+		/** Fresh deaths nearby lower the score, fading over time and with each door in between */
+		float RecentDeathPenalty = 0.0f;
+		for (const FRoomRecentDeath& RecentDeath : RecentDeaths)
 		{
-			RoomCollection[Index].bIsOccupied = bIsOccupied;
-			return;
-		} 
+			const float DeathAge = TimeSeconds - RecentDeath.DeathTime;
+			if (!RoomCollection.IsValidIndex(RecentDeath.RoomIndex) || DeathAge >= RecentDeathDuration)
+			{ continue; }
+
+			const uint16 DeathHops = GetRoomDistanceRow(RecentDeath.RoomIndex)[RoomIndex];
+			if (DeathHops != UnreachableRoomDistance)
+			{ RecentDeathPenalty += (1.0f - DeathAge / RecentDeathDuration) / (1.0f + DeathHops); }
+		}
+
+		const float RoomScore = OpponentHops - RecentDeathWeight * RecentDeathPenalty + FMath::FRand() * RespawnScoreJitter;
+		if (RoomScore > BestRoomScore)
+		{
+			BestRoomIndex = RoomIndex;
+			BestRoomScore = RoomScore;
+		}
+	}
+
+	if (BestRoomIndex == INDEX_NONE)
+	{ return false; }
+
+	OutRespawnLocation = RoomSpawnPoints[FMath::RandRange(
+		RoomSpawnPointOffsets[BestRoomIndex],
+		RoomSpawnPointOffsets[BestRoomIndex + 1] - 1)];
+	return true;
+}
+#pragma endregion="Respawn"
+
+#pragma region="OccupancyReplication"
+void ARoomManager::OnRep_RoomOccupancyBits()
+{
+	ApplyRoomOccupancyBits();
+}
+
+void ARoomManager::ApplyRoomOccupancyBits()
+{
+	/** Bits for rooms this client has not indexed yet are applied once it has */
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
+	{
+		FRoomListing& RoomListing = RoomCollection[RoomIndex];
+		const bool bRoomOccupied = GetRoomOccupancyBit(RoomOccupancyBits, RoomIndex);
+		if (RoomListing.bIsOccupied == bRoomOccupied)
+		{ continue; }
+
+		RoomListing.bIsOccupied = bRoomOccupied;
+		OnRoomOccupancyChanged.Broadcast(RoomListing.Room, bRoomOccupied);
+	}
+}
+
+void ARoomManager::WriteRoomOccupancyBits()
+{
+	RoomOccupancyBits.Init(0, FMath::DivideAndRoundUp(RoomCollection.Num(), 8));
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
+	{
+		if (RoomCollection[RoomIndex].bIsOccupied)
+		{ RoomOccupancyBits[RoomIndex / 8] |= 1 << (RoomIndex % 8); }
+	}
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RoomOccupancyBits, this);
+}
+
+bool ARoomManager::GetRoomOccupancyBit(const TArray<uint8>& InOccupancyBits, const int32 InRoomIndex)
+{
+	const int32 ByteIndex = InRoomIndex / 8;
+	return InOccupancyBits.IsValidIndex(ByteIndex) && (InOccupancyBits[ByteIndex] & (1 << (InRoomIndex % 8))) != 0;
+}
+#pragma endregion="OccupancyReplication"
+
+#pragma region="OccupancyTracking"
+void ARoomManager::SampleRoomOccupancy()
+{
+	/** Drop characters which have since been destroyed */
+	for (auto TrackedIterator = TrackedCharacterRooms.CreateIterator(); TrackedIterator; ++TrackedIterator)
+	{
+		if (!TrackedIterator.Key().IsValid())
+		{ TrackedIterator.RemoveCurrent(); }
+	}
+	
+	for (TActorIterator<ASpyCharacter> CharacterIterator(GetWorld()); CharacterIterator; ++CharacterIterator)
+	{
+		ASpyCharacter* SpyCharacter = *CharacterIterator;
+		ASVSRoom* SampledRoom = FindRoomAtLocation(SpyCharacter->GetActorLocation());
+		
+		/** A character between floor plans, ex: in a doorway, remains in the room they were last found in */
+		TWeakObjectPtr<ASVSRoom>& TrackedRoom = TrackedCharacterRooms.FindOrAdd(SpyCharacter);
+		if (!IsValid(SampledRoom) || TrackedRoom.Get() == SampledRoom)
+		{ continue; }
+
+		ASVSRoom* PreviousRoom = TrackedRoom.Get();
+		TrackedRoom = SampledRoom;
+
+		/** Same order as trigger overlaps, rooms update their occupants before the character processes the change */
+		if (IsValid(PreviousRoom))
+		{ PreviousRoom->NotifySpyCharacterExited(SpyCharacter); }
+		SampledRoom->NotifySpyCharacterEntered(SpyCharacter);
+		SpyCharacter->SetTrackedRoom(SampledRoom);
+	}
+}
+
+void ARoomManager::UntrackSpyCharacter(ASpyCharacter* InSpyCharacter)
+{
+	TWeakObjectPtr<ASVSRoom> TrackedRoom;
+	if (!TrackedCharacterRooms.RemoveAndCopyValue(InSpyCharacter, TrackedRoom))
+	{ return; }
+
+	if (ASVSRoom* PreviousRoom = TrackedRoom.Get())
+	{ PreviousRoom->NotifySpyCharacterExited(InSpyCharacter); }
+}
+#pragma endregion="OccupancyTracking"
+
+#pragma region="RoomTransition"
+void ARoomManager::InitRoomTransitionSlots()
+{
+	if (!IsValid(RoomTransitionCollection))
+	{
+		UE_LOG(SVSLog, Warning, TEXT("RoomManager has no Room Transition Collection, rooms will use Custom Primitive Data"));
+		return;
+	}
+	
+	RoomTransitionCollectionInstance = GetWorld()->GetParameterCollectionInstance(RoomTransitionCollection);
+	if (!IsValid(RoomTransitionCollectionInstance))
+	{ return; }
+
+	RoomTransitionSlotNames.Reset(RoomTransitionSlotCount);
+	for (uint8 SlotIndex = 0; SlotIndex < RoomTransitionSlotCount; SlotIndex++)
+	{
+		const FName SlotName = *FString::Printf(TEXT("%s%i"), *RoomTransitionSlotPrefix, SlotIndex);
+		if (!RoomTransitionCollection->GetVectorParameterByName(SlotName))
+		{
+			UE_LOG(SVSLog, Warning, TEXT("RoomManager Room Transition Collection is missing parameter: %s"), *SlotName.ToString());
+			break;
+		}
+		RoomTransitionSlotNames.Emplace(SlotName);
+	}
+	RoomTransitionSlotOwners.Init(0, RoomTransitionSlotNames.Num());
+}
+
+int32 ARoomManager::AcquireRoomTransitionSlot(const int32 InRoomTransitionId)
+{
+	if (RoomTransitionMode != ERoomTransitionMode::ParameterCollection ||
+		!IsValid(RoomTransitionCollectionInstance) ||
+		InRoomTransitionId <= 0)
+	{ return INDEX_NONE; }
+
+	const int32 SlotIndex = RoomTransitionSlotOwners.Find(0);
+	if (SlotIndex != INDEX_NONE)
+	{ RoomTransitionSlotOwners[SlotIndex] = InRoomTransitionId; }
+	return SlotIndex;
+}
+
+void ARoomManager::ReleaseRoomTransitionSlot(const int32 InSlotIndex)
+{
+	if (!RoomTransitionSlotOwners.IsValidIndex(InSlotIndex))
+	{ return; }
+
+	/** Clear the Room ID so materials stop matching the slot and read their Custom Primitive Data again */
+	RoomTransitionSlotOwners[InSlotIndex] = 0;
+	if (IsValid(RoomTransitionCollectionInstance))
+	{ RoomTransitionCollectionInstance->SetVectorParameterValue(RoomTransitionSlotNames[InSlotIndex], FLinearColor::Transparent); }
+}
+
+void ARoomManager::SetRoomTransitionSlotValues(const int32 InSlotIndex, const FVector& InValues) const
+{
+	if (!RoomTransitionSlotOwners.IsValidIndex(InSlotIndex) || !IsValid(RoomTransitionCollectionInstance))
+	{ return; }
+
+	RoomTransitionCollectionInstance->SetVectorParameterValue(
+		RoomTransitionSlotNames[InSlotIndex],
+		FLinearColor(static_cast<float>(RoomTransitionSlotOwners[InSlotIndex]), InValues.X, InValues.Y, InValues.Z));
+}
+#pragma endregion="RoomTransition"
+
+#pragma region="RoomSignificance"
+void ARoomManager::EvaluateRoomSignificance()
+{
+	/** Rooms or doors may have been indexed since the last evaluation, wake everything before indices move */
+	if (DormantRooms.Num() != RoomCollection.Num() || DormantDoors.Num() != RoomDoorCollection.Num())
+	{
+		for (int32 RoomIndex = 0; RoomIndex < DormantRooms.Num(); RoomIndex++)
+		{ SetRoomDormant(RoomIndex, false); }
+		for (FRoomDormantActor& DormantDoor : DormantDoors)
+		{
+			if (!DormantDoor.Actor.IsValid())
+			{ continue; }
+			WakeActor(DormantDoor);
+			NumDormantRoomActors--;
+		}
+		
+		DormantRooms.Init(false, RoomCollection.Num());
+		DormantRoomActors.SetNum(RoomCollection.Num());
+		DormantDoors.Init(FRoomDormantActor(), RoomDoorCollection.Num());
+	}
+	
+	/** Gather the floor plan centres of the rooms local players are in */
+	TArray<FVector2D, TInlineAllocator<4>> LocalPlayerRoomCentres;
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (!IsValid(PlayerController) || !PlayerController->IsLocalController())
+		{ continue; }
+
+		if (const ASpyCharacter* SpyCharacter = PlayerController->GetPawn<ASpyCharacter>())
+		{
+			const int32 RoomIndex = GetRoomListingIndex(SpyCharacter->GetCurrentRoom());
+			if (RoomIndex != INDEX_NONE)
+			{ LocalPlayerRoomCentres.Emplace(RoomCollection[RoomIndex].RoomBounds.GetCenter()); }
+		}
+	}
+	
+	/** Nothing to measure from until a local player has entered a room */
+	if (LocalPlayerRoomCentres.Num() == 0)
+	{ return; }
+
+	const float WakeDistanceSquared = FMath::Square(FMath::Max(DormantRoomDistance - DormantRoomHysteresis, 0.0f));
+	const float DormantDistanceSquared = FMath::Square(DormantRoomDistance);
+	for (int32 RoomIndex = 0; RoomIndex < RoomCollection.Num(); RoomIndex++)
+	{
+		const ASVSRoom* Room = RoomCollection[RoomIndex].Room;
+		if (!IsValid(Room))
+		{ continue; }
+
+		float ClosestDistanceSquared = TNumericLimits<float>::Max();
+		for (const FVector2D& LocalPlayerRoomCentre : LocalPlayerRoomCentres)
+		{
+			ClosestDistanceSquared = FMath::Min(
+				ClosestDistanceSquared,
+				FVector2D::DistSquared(LocalPlayerRoomCentre, RoomCollection[RoomIndex].RoomBounds.GetCenter()));
+		}
+
+		/** Anything the local player can see, or is about to see, stays awake */
+		const bool bRoomInUse = !Room->IsRoomLocallyHidden() || Room->IsRoomPrewarmed() || Room->IsRoomTransitioning();
+		if (DormantRooms[RoomIndex])
+		{
+			if (bRoomInUse || ClosestDistanceSquared < WakeDistanceSquared)
+			{ SetRoomDormant(RoomIndex, false); }
+		}
+		else if (!bRoomInUse && ClosestDistanceSquared > DormantDistanceSquared)
+		{ SetRoomDormant(RoomIndex, true); }
+	}
+
+	for (int32 DoorIndex = 0; DoorIndex < RoomDoorCollection.Num(); DoorIndex++)
+	{
+		const FRoomDoorListing& DoorListing = RoomDoorCollection[DoorIndex];
+		FRoomDormantActor& DormantDoor = DormantDoors[DoorIndex];
+		const bool bDoorDormant = DormantRooms[DoorListing.RoomIndexA] && DormantRooms[DoorListing.RoomIndexB];
+		if (bDoorDormant && !DormantDoor.Actor.IsValid())
+		{
+			PutActorToSleep(DoorListing.Door, DormantDoor);
+			if (DormantDoor.Actor.IsValid())
+			{ NumDormantRoomActors++; }
+		}
+		else if (!bDoorDormant && DormantDoor.Actor.IsValid())
+		{
+			WakeActor(DormantDoor);
+			NumDormantRoomActors--;
+		}
+	}
+	
+	SET_DWORD_STAT(STAT_SVSDormantRoomActors, NumDormantRoomActors);
+}
+
+void ARoomManager::WakeDormantRoom(const ASVSRoom* InRoom)
+{
+	const int32 RoomIndex = GetRoomListingIndex(InRoom);
+	if (RoomIndex == INDEX_NONE || !DormantRooms.IsValidIndex(RoomIndex) || !DormantRooms[RoomIndex])
+	{ return; }
+
+	SetRoomDormant(RoomIndex, false);
+	SET_DWORD_STAT(STAT_SVSDormantRoomActors, NumDormantRoomActors);
+}
+
+void ARoomManager::SetRoomDormant(const int32 InRoomIndex, const bool bDormant)
+{
+	if (!DormantRooms.IsValidIndex(InRoomIndex) || DormantRooms[InRoomIndex] == bDormant)
+	{ return; }
+	DormantRooms[InRoomIndex] = bDormant;
+
+	TArray<FRoomDormantActor>& RoomDormantActors = DormantRoomActors[InRoomIndex];
+	if (!bDormant)
+	{
+		for (FRoomDormantActor& DormantActor : RoomDormantActors)
+		{ WakeActor(DormantActor); }
+		NumDormantRoomActors -= RoomDormantActors.Num();
+		RoomDormantActors.Reset();
+		return;
+	}
+
+	ASVSRoom* Room = RoomCollection[InRoomIndex].Room;
+	if (!IsValid(Room))
+	{ return; }
+
+	TArray<AActor*> RoomActors;
+	Room->GetRoomActors(RoomActors);
+	for (AActor* RoomActor : RoomActors)
+	{ PutActorToSleep(RoomActor, RoomDormantActors.AddDefaulted_GetRef()); }
+	NumDormantRoomActors += RoomDormantActors.Num();
+}
+
+void ARoomManager::PutActorToSleep(AActor* InActor, FRoomDormantActor& OutDormantActor)
+{
+	OutDormantActor = FRoomDormantActor();
+	if (!IsValid(InActor))
+	{ return; }
+	OutDormantActor.Actor = InActor;
+
+	/** Only record what was running so waking does not enable anything that was meant to be off */
+	if (InActor->IsActorTickEnabled())
+	{
+		InActor->SetActorTickEnabled(false);
+		OutDormantActor.bActorTickDisabled = true;
+	}
+
+	TInlineComponentArray<UActorComponent*> Components(InActor);
+	for (UActorComponent* Component : Components)
+	{
+		/** Disabling component ticks also stops timelines, skeletal animation and effects */
+		if (Component->IsComponentTickEnabled())
+		{
+			Component->SetComponentTickEnabled(false);
+			OutDormantActor.TickDisabledComponents.Emplace(Component);
+		}
+
+		UAudioComponent* AudioComponent = Cast<UAudioComponent>(Component);
+		if (IsValid(AudioComponent) && AudioComponent->IsPlaying() && !AudioComponent->bIsPaused)
+		{
+			AudioComponent->SetPaused(true);
+			OutDormantActor.PausedAudioComponents.Emplace(AudioComponent);
+		}
+	}
+}
+
+void ARoomManager::WakeActor(FRoomDormantActor& InOutDormantActor)
+{
+	if (AActor* Actor = InOutDormantActor.Actor.Get())
+	{
+		if (InOutDormantActor.bActorTickDisabled)
+		{ Actor->SetActorTickEnabled(true); }
+		
+		for (const TWeakObjectPtr<UActorComponent>& Component : InOutDormantActor.TickDisabledComponents)
+		{
+			if (Component.IsValid())
+			{ Component->SetComponentTickEnabled(true); }
+		}
+		for (const TWeakObjectPtr<UAudioComponent>& AudioComponent : InOutDormantActor.PausedAudioComponents)
+		{
+			if (AudioComponent.IsValid())
+			{ AudioComponent->SetPaused(false); }
+		}
 	}
+	InOutDormantActor = FRoomDormantActor();
 }
+#pragma endregion="RoomSignificance"
@@ -55,6 +55,28 @@ void ASVSDynamicDoor::SetEnableDoorMesh_Implementation(const bool bEnabled)
 	}
 }
 
+void ASVSDynamicDoor::PrewarmAdjacentRooms() const
+{
+	if (IsRunningDedicatedServer())
+	{ return; }
+	
+	ASVSRoom* SVSRoomA = Cast<ASVSRoom>(RoomA);
+	ASVSRoom* SVSRoomB = Cast<ASVSRoom>(RoomB);
+	if (!IsValid(SVSRoomA) || !IsValid(SVSRoomB))
+	{ return; }
+
+	/** Only the destination room needs work, the local player can already see the room they are in */
+	if (!SVSRoomA->IsRoomLocallyHidden() && SVSRoomB->IsRoomLocallyHidden())
+	{ SVSRoomB->PrewarmRoom(); }
+	else if (!SVSRoomB->IsRoomLocallyHidden() && SVSRoomA->IsRoomLocallyHidden())
+	{ SVSRoomA->PrewarmRoom(); }
+}
+
+bool ASVSDynamicDoor::IsDoorOfRoom(const ASVSRoom* InRoom) const
+{
+	return IsValid(InRoom) && (Cast<ASVSRoom>(RoomA) == InRoom || Cast<ASVSRoom>(RoomB) == InRoom);
+}
+
 void ASVSDynamicDoor::OnRoomOccupancyChange(const ASVSRoom* InRoomActor, const bool bIsRoomHidden)
 {
 	const ASVSRoom* SVSRoomA = Cast<ASVSRoom>(RoomA);
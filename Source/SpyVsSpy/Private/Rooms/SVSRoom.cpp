@@ -13,7 +13,7 @@
 #include "Rooms/SpyFurniture.h"
 #include "Components/TimelineComponent.h"
 #include "GameModes/SpyVsSpyGameState.h"
-#include "Kismet/KismetGuidLibrary.h"
+#include "GameFramework/PlayerController.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Materials/MaterialParameterCollectionInstance.h"
 
@@ -45,9 +45,14 @@ void ASVSRoom::OnConstruction(const FTransform& Transform)
 		FRotator::ZeroRotator,
 		FVector(NewRoomTranslation.X, NewRoomTranslation.Y, NewRoomTranslation.Z + RoomTriggerScaleMargin+RoomTriggerHeight/2),
 		FVector(NewRoomScale.X - RoomTriggerScaleMargin, NewRoomScale.Y - RoomTriggerScaleMargin, RoomTriggerHeight)));
+}
+
+void ASVSRoom::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
 
-	/** Assign Unique ID to Room */
-	RoomGuid = UKismetGuidLibrary::NewGuid();
+	/** Assign Unique ID to Room, PIE prefixes differ between server and clients so are removed */
+	RoomGuid = FGuid::NewDeterministicGuid(UWorld::RemovePIEPrefix(GetPathName()));
 }
 
 void ASVSRoom::BeginPlay()
@@ -68,10 +73,10 @@ void ASVSRoom::BeginPlay()
 	else { UE_LOG(SVSLog, Warning, TEXT("Room Appear Timeline Curve not valid")); }
 	
 	/** Set initial state of the warp in/out effect */
-	// TODO Check if we need to do this for each component - Walls / Floor(s)
-	GetDynamicMeshComponent()->SetCustomPrimitiveDataFloat(0, VisibilityDirection);
-	for (UDynamicWall* Wall : DynamicWallSet)
-	{ Wall->SetCustomPrimitiveDataFloat(0, VisibilityDirection); }
+	CacheVanishParameterBlock();
+	BakeRoomTransitionId();
+	SetVanishVisibility(VisibilityDirection);
+	FlushVanishParameterBlock();
 	
 	/** Hide furniture */
 	for (AFurnitureBase* FurnitureItem : FurnitureCollection)
@@ -80,7 +85,7 @@ void ASVSRoom::BeginPlay()
 		{ FurnitureItem->SetActorHiddenInGame(true); }
 	}
 
-	if(HasAuthority())
+	if(!IsNetMode(NM_Client))
 	{
 		/** Optimisticly Register with Room Manager, otherwise Room Manager will grab all rooms
 		 * if the below AddRoom is run before the Manager is created in world */
@@ -93,11 +98,34 @@ void ASVSRoom::BeginPlay()
 		}
 	}
 
-	UE_LOG(SVSLogDebug, Log, TEXT("Room adding overlap delegates"));
-	/** Add delegate for Room Trigger overlaps */
-	OnActorBeginOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapBegin);
-	OnActorEndOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapEnd);
+	/** Room Manager may have already taken over occupancy tracking */
+	if (bOccupancyTriggerEnabled)
+	{
+		UE_LOG(SVSLogDebug, Log, TEXT("Room adding overlap delegates"));
+		/** Add delegate for Room Trigger overlaps */
+		OnActorBeginOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapBegin);
+		OnActorEndOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapEnd);
+	}
+}
+
+void ASVSRoom::SetOccupancyTriggerEnabled(const bool bEnabled)
+{
+	bOccupancyTriggerEnabled = bEnabled;
 	
+	/** Remove the trigger from the physics scene entirely rather than ignore its overlaps */
+	RoomTrigger->SetGenerateOverlapEvents(bEnabled);
+	RoomTrigger->SetCollisionEnabled(bEnabled ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
+
+	if (bEnabled)
+	{
+		OnActorBeginOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapBegin);
+		OnActorEndOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapEnd);
+	}
+	else
+	{
+		OnActorBeginOverlap.RemoveDynamic(this, &ThisClass::OnOverlapBegin);
+		OnActorEndOverlap.RemoveDynamic(this, &ThisClass::OnOverlapEnd);
+	}
 }
 
 // #if WITH_EDITOR
@@ -248,30 +276,30 @@ FVanishPrimitiveData ASVSRoom::SetRoomTraversalDirection(const ASpyCharacter* Pl
 
 void ASVSRoom::UnHideRoom(const ASpyCharacter* InSpyCharacter)
 {
+	/** The appear timeline does not advance while the room is dormant */
+	if (IsValid(RoomManager))
+	{ RoomManager->WakeDormantRoom(this); }
+
 	/** Unhide */
 	bRoomLocallyHiddenInGame = false; // Also used in timeline finished func to make Static Meshes Visible
 	SetActorHiddenInGame(bRoomLocallyHiddenInGame);
 	const FVanishPrimitiveData CustomPrimitiveData = SetRoomTraversalDirection(InSpyCharacter, true);
 	// UE_LOG(SVSLogDebug, Log, TEXT("Room Enter Prim Data - Axis: %f, Traversal: %f, AxisDirection: %f"), CustomPrimitiveData.Axis, CustomPrimitiveData.Traversal, CustomPrimitiveData.AxisDirection);
 		
-	/** Update Walls */
-	TArray<UDynamicWall*> WallSet;
-	Execute_GetWalls(this, WallSet);
-	for (UDynamicWall* DynamicWall : WallSet)
-	{
-		DynamicWall->SetCustomPrimitiveDataFloat(1, CustomPrimitiveData.AxisDirection);
-		DynamicWall->SetCustomPrimitiveDataFloat(2, CustomPrimitiveData.Axis);
-	}
-
-	/** Update Floor */
-	Execute_GetRoomFloor(this)->SetCustomPrimitiveDataFloat(1, CustomPrimitiveData.AxisDirection);
-	Execute_GetRoomFloor(this)->SetCustomPrimitiveDataFloat(2, CustomPrimitiveData.Axis);
+	/** Update Walls and Floor, written with the first timeline update */
+	AcquireRoomTransitionSlot();
+	SetVanishTraversal(CustomPrimitiveData);
 
 	/** Run the Appear effect timeline */
 	if (IsValid(AppearTimeline))
 	{ AppearTimeline->PlayFromStart(); }
 	else
-	{ UE_LOG(SVSLog, Warning, TEXT("Room timeline for appear effect is null")); }
+	{
+		/** No timeline will finish to free the slot */
+		ReleaseRoomTransitionSlot();
+		FlushVanishParameterBlock();
+		UE_LOG(SVSLog, Warning, TEXT("Room timeline for appear effect is null"));
+	}
 
 
 
@@ -302,6 +330,98 @@ void ASVSRoom::UnHideRoom(const ASpyCharacter* InSpyCharacter)
 		if (IsValid(Furniture))
 		{ Furniture->SetActorHiddenInGame(bRoomLocallyHiddenInGame); }
 	}
+	
+	/** A prewarmed room already has its proxies so revealing furniture only removes it from the view hidden lists */
+	if (bRoomPrewarmed)
+	{
+		bRoomPrewarmed = false;
+		GetWorldTimerManager().ClearTimer(PrewarmTimeoutTimerHandle);
+		SetFurnitureHiddenFromLocalViews(false);
+	}
+}
+
+void ASVSRoom::GetRoomActors(TArray<AActor*>& OutRoomActors)
+{
+	OutRoomActors.Emplace(this);
+	for (AFurnitureBase* Furniture : FurnitureCollection)
+	{
+		if (IsValid(Furniture))
+		{ OutRoomActors.Emplace(Furniture); }
+	}
+}
+
+bool ASVSRoom::IsRoomTransitioning() const
+{
+	return IsValid(AppearTimeline) && AppearTimeline->IsPlaying();
+}
+
+void ASVSRoom::PrewarmRoom()
+{
+	if (!bRoomLocallyHiddenInGame || bRoomPrewarmed || IsRunningDedicatedServer())
+	{ return; }
+	bRoomPrewarmed = true;
+
+	if (IsValid(RoomManager))
+	{ RoomManager->WakeDormantRoom(this); }
+
+	/** Walls and floor are invisible at zero visibility so the room can enter the scene unseen */
+	SetVanishVisibility(0.0f);
+	FlushVanishParameterBlock();
+	SetActorHiddenInGame(false);
+	PrestreamTextures(PrewarmTextureStreamDuration, true);
+
+	/** Furniture has no vanish effect so it is hidden per view instead of being removed from the scene */
+	SetFurnitureHiddenFromLocalViews(true);
+	for (AFurnitureBase* Furniture : FurnitureCollection)
+	{
+		if (IsValid(Furniture))
+		{
+			Furniture->SetActorHiddenInGame(false);
+			Furniture->PrestreamTextures(PrewarmTextureStreamDuration, true);
+		}
+	}
+	
+	GetWorldTimerManager().SetTimer(PrewarmTimeoutTimerHandle, this, &ThisClass::ReleasePrewarm, PrewarmTimeout, false);
+}
+
+void ASVSRoom::ReleasePrewarm()
+{
+	if (!bRoomPrewarmed)
+	{ return; }
+	bRoomPrewarmed = false;
+
+	/** Room was entered in the meantime, UnHideRoom has taken over */
+	if (!bRoomLocallyHiddenInGame)
+	{ return; }
+	
+	SetActorHiddenInGame(true);
+	for (AFurnitureBase* Furniture : FurnitureCollection)
+	{
+		if (IsValid(Furniture))
+		{ Furniture->SetActorHiddenInGame(true); }
+	}
+	SetFurnitureHiddenFromLocalViews(false);
+}
+
+void ASVSRoom::SetFurnitureHiddenFromLocalViews(const bool bHiddenFromLocalViews) const
+{
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = Iterator->Get();
+		if (!IsValid(PlayerController) || !PlayerController->IsLocalController())
+		{ continue; }
+
+		for (AFurnitureBase* Furniture : FurnitureCollection)
+		{
+			if (!IsValid(Furniture))
+			{ continue; }
+			
+			if (bHiddenFromLocalViews)
+			{ PlayerController->HiddenActors.AddUnique(Furniture); }
+			else
+			{ PlayerController->HiddenActors.Remove(Furniture); }
+		}
+	}
 }
 
 void ASVSRoom::HideRoom(const ASpyCharacter* InSpyCharacter)
@@ -315,24 +435,10 @@ void ASVSRoom::HideRoom(const ASpyCharacter* InSpyCharacter)
 	bRoomLocallyHiddenInGame = true; // Also used in timeline finished func to make Static Meshes Visible
 	const FVanishPrimitiveData CustomPrimitiveData = SetRoomTraversalDirection(InSpyCharacter, true);
 	// UE_LOG(SVSLogDebug, Log, TEXT("Room Exit Prim Data - Axis: %f, Traversal: %f, AxisDirection: %f"), CustomPrimitiveData.Axis, CustomPrimitiveData.Traversal, CustomPrimitiveData.AxisDirection);
-		
-	GetDynamicMeshComponent()->SetCustomPrimitiveDataFloat(1, CustomPrimitiveData.AxisDirection);
-	// UE_LOG(SVSLogDebug, Log, TEXT("Room Exit AxisDirection: %f"), CustomPrimitiveData.AxisDirection);
-	GetDynamicMeshComponent()->SetCustomPrimitiveDataFloat(2, CustomPrimitiveData.Axis);
-	// UE_LOG(SVSLogDebug, Log, TEXT("Room Exit Axis: %f"), CustomPrimitiveData.Axis);
 
-	/** Update Walls */
-	TArray<UDynamicWall*> WallSet;
-	Execute_GetWalls(this, WallSet);
-	for (UDynamicWall* DynamicWall : WallSet)
-	{
-		DynamicWall->SetCustomPrimitiveDataFloat(1, CustomPrimitiveData.AxisDirection);
-		DynamicWall->SetCustomPrimitiveDataFloat(2, CustomPrimitiveData.Axis);
-	}
-
-	/** Update Floor */
-	Execute_GetRoomFloor(this)->SetCustomPrimitiveDataFloat(1, CustomPrimitiveData.AxisDirection);
-	Execute_GetRoomFloor(this)->SetCustomPrimitiveDataFloat(2, CustomPrimitiveData.Axis);
+	/** Update Walls and Floor, written with the first timeline update */
+	AcquireRoomTransitionSlot();
+	SetVanishTraversal(CustomPrimitiveData);
 
 	/** Set Room Furniture visibility */
 	for (AFurnitureBase* Furniture : FurnitureCollection)
@@ -345,7 +451,12 @@ void ASVSRoom::HideRoom(const ASpyCharacter* InSpyCharacter)
 	if (IsValid(AppearTimeline))
 	{ AppearTimeline->ReverseFromEnd();	}
 	else
-	{ UE_LOG(SVSLog, Warning, TEXT("Room timeline for disappear effect is null")); }
+	{
+		/** No timeline will finish to free the slot */
+		ReleaseRoomTransitionSlot();
+		FlushVanishParameterBlock();
+		UE_LOG(SVSLog, Warning, TEXT("Room timeline for disappear effect is null"));
+	}
 }
 
 void ASVSRoom::OnOverlapBegin(AActor* OverlappedActor, AActor* OtherActor)
@@ -354,60 +465,188 @@ void ASVSRoom::OnOverlapBegin(AActor* OverlappedActor, AActor* OtherActor)
 	//if (OtherActor->GetLocalRole() == ROLE_SimulatedProxy) { return; }
 
 	if(ASpyCharacter* SpyCharacter = Cast<ASpyCharacter>(OtherActor))
-	{
-		if (IsValid(RoomManager) && HasAuthority())
-		{ RoomManager->SetRoomOccupied(this, true, SpyCharacter); }
-		
-		OccupyingSpyCharacters.Emplace(SpyCharacter);
-		
-		/** Run client only Unhide logic */
-		if (SpyCharacter->GetLocalRole() == ROLE_AutonomousProxy)
-		{ UnHideRoom(SpyCharacter); }
-	}
+	{ NotifySpyCharacterEntered(SpyCharacter); }
 }
 
 void ASVSRoom::OnOverlapEnd(AActor* OverlappedActor, AActor* OtherActor)
 {
 	if(ASpyCharacter* SpyCharacter = Cast<ASpyCharacter>(OtherActor))
-	{
-		OccupyingSpyCharacters.Remove(SpyCharacter);
-		HideRoom(SpyCharacter);
+	{ NotifySpyCharacterExited(SpyCharacter); }
+}
+
+void ASVSRoom::NotifySpyCharacterEntered(ASpyCharacter* SpyCharacter)
+{
+	if (!IsValid(SpyCharacter))
+	{ return; }
+	
+	OccupyingSpyCharacters.AddUnique(SpyCharacter);
+	
+	if (IsValid(RoomManager) && RoomManager->HasAuthority())
+	{ RoomManager->SetRoomOccupied(this, true, SpyCharacter); }
 		
-		if (IsValid(RoomManager) && HasAuthority())
-		{ RoomManager->SetRoomOccupied(this, false, SpyCharacter); }
-	}
+	/** Run client only Unhide logic */
+	if (SpyCharacter->GetLocalRole() == ROLE_AutonomousProxy)
+	{ UnHideRoom(SpyCharacter); }
+}
+
+void ASVSRoom::NotifySpyCharacterExited(ASpyCharacter* SpyCharacter)
+{
+	if (!IsValid(SpyCharacter))
+	{ return; }
+	
+	OccupyingSpyCharacters.Remove(SpyCharacter);
+	HideRoom(SpyCharacter);
+		
+	if (IsValid(RoomManager) && RoomManager->HasAuthority())
+	{ RoomManager->SetRoomOccupied(this, false, SpyCharacter); }
+}
+
+void ASVSRoom::TimelineAppearUpdate(float const VisibilityInterp)
+{
+	/** Hide the Hierarchical Instanced Static Meshes which are used as Room Decorators and apply effect to floor */
+	SetVanishVisibility(VisibilityInterp);
+	FlushVanishParameterBlock();
+}
+
+void ASVSRoom::TimelineAppearFinish()
+{
+	OnRoomOccupancyChange.Broadcast(this, bRoomLocallyHiddenInGame);
+	SetActorHiddenInGame(bRoomLocallyHiddenInGame); // Will already be visible if timeline makes room Appear
+
+	/** Free the collection slot for other rooms */
+	ReleaseRoomTransitionSlot();
 }
 
-void ASVSRoom::TimelineAppearUpdate(float const VisibilityInterp) const
+void ASVSRoom::CacheVanishParameterBlock()
 {
+	VanishParameterBlock.Components.Reset();
+	VanishParameterBlock.ComponentFollowsVisibility.Reset();
+	VanishParameterBlock.ComponentWrittenValues.Reset();
+
 	TArray<UDynamicWall*> WallSet;
 	Execute_GetWalls(this, WallSet);
-	
-	/** Hide the Hierarchical Instanced Static Meshes which are used as Room Decorators */
 	for (UDynamicWall* DynamicWall : WallSet)
 	{
-		// TODO refactor this for dynamic checks
+		if (!IsValid(DynamicWall) || VanishParameterBlock.Components.Contains(DynamicWall))
+		{ continue; }
+		
+		VanishParameterBlock.Components.Emplace(DynamicWall);
+		// TODO refactor this so that a trace determines which walls to
+		// hide should camera change cardinal directions
 		// TODO need to flip effect since walls are mirrored
-		if (DynamicWall != WestWall && DynamicWall != SouthWall)
-		{ DynamicWall->SetCustomPrimitiveDataFloat(0, VisibilityInterp); }
+		VanishParameterBlock.ComponentFollowsVisibility.Add(DynamicWall != WestWall && DynamicWall != SouthWall);
+	}
+	
+	/** Floor can be both the room mesh and a separate floor component */
+	const TArray<UPrimitiveComponent*, TInlineAllocator<2>> FloorComponents = {
+		Cast<UPrimitiveComponent>(GetDynamicMeshComponent()),
+		Cast<UPrimitiveComponent>(Execute_GetRoomFloor(this))};
+	for (UPrimitiveComponent* FloorComponent : FloorComponents)
+	{
+		if (!IsValid(FloorComponent) || VanishParameterBlock.Components.Contains(FloorComponent))
+		{ continue; }
+		
+		VanishParameterBlock.Components.Emplace(FloorComponent);
+		VanishParameterBlock.ComponentFollowsVisibility.Add(true);
 	}
 
-	/** Apply effect to floor */
-	Execute_GetRoomFloor(this)->SetCustomPrimitiveDataFloat(0, VisibilityInterp);
+	/** Nothing has been written yet so every component is written on the first flush */
+	VanishParameterBlock.ComponentWrittenValues.SetNum(VanishParameterBlock.Components.Num());
+	VanishParameterBlock.bDirty = true;
 }
 
-void ASVSRoom::TimelineAppearFinish()
+void ASVSRoom::SetVanishVisibility(const float InVisibility)
 {
-	OnRoomOccupancyChange.Broadcast(this, bRoomLocallyHiddenInGame);
-	SetActorHiddenInGame(bRoomLocallyHiddenInGame); // Will already be visible if timeline makes room Appear
+	VanishParameterBlock.Visibility = InVisibility;
+	VanishParameterBlock.bDirty = true;
+}
+
+void ASVSRoom::SetVanishTraversal(const FVanishPrimitiveData& InVanishPrimitiveData)
+{
+	VanishParameterBlock.AxisDirection = InVanishPrimitiveData.AxisDirection;
+	VanishParameterBlock.Axis = InVanishPrimitiveData.Axis;
+	VanishParameterBlock.bDirty = true;
+}
+
+void ASVSRoom::FlushVanishParameterBlock()
+{
+	if (!VanishParameterBlock.bDirty)
+	{ return; }
+	VanishParameterBlock.bDirty = false;
+
+	const FVector FollowingValues(
+		VanishParameterBlock.Visibility,
+		VanishParameterBlock.AxisDirection,
+		VanishParameterBlock.Axis);
+
+	/** While animating with a collection slot a single parameter write covers every component */
+	if (RoomTransitionSlot != INDEX_NONE && IsValid(RoomManager))
+	{
+		RoomManager->SetRoomTransitionSlotValues(RoomTransitionSlot, FollowingValues);
+		return;
+	}
+	
+	for (int32 ComponentIndex = 0; ComponentIndex < VanishParameterBlock.Components.Num(); ComponentIndex++)
+	{
+		UPrimitiveComponent* Component = VanishParameterBlock.Components[ComponentIndex];
+		
+		/** Walls which do not follow the timeline are kept fully hidden */
+		const FVector& Values = VanishParameterBlock.ComponentFollowsVisibility[ComponentIndex] ?
+			FollowingValues :
+			FVector::ZeroVector;
+		TOptional<FVector>& WrittenValues = VanishParameterBlock.ComponentWrittenValues[ComponentIndex];
+		if (!IsValid(Component) || (WrittenValues.IsSet() && WrittenValues.GetValue() == Values))
+		{ continue; }
+
+		/** Slots 0 to 2 in a single update rather than one update per slot */
+		Component->SetCustomPrimitiveDataVector3(0, Values);
+		WrittenValues = Values;
+	}
+}
 
-	// TODO refactor this so that a trace determines which walls to
-	// hide should camera change cardinal directions
-	WestWall->SetCustomPrimitiveDataFloat(0, 0.0);
-	WestWall->SetCustomPrimitiveDataFloat(1, 0);
-	WestWall->SetCustomPrimitiveDataFloat(2, 0);
-	SouthWall->SetCustomPrimitiveDataFloat(0, 0.0);
-	SouthWall->SetCustomPrimitiveDataFloat(1, 0);
-	SouthWall->SetCustomPrimitiveDataFloat(2, 0);
+void ASVSRoom::SetRoomIndex(const uint16 InRoomIndex)
+{
+	if (RoomIndex == InRoomIndex)
+	{ return; }
+	
+	RoomIndex = InRoomIndex;
+	RoomTransitionId = RoomIndex + 1;
+	BakeRoomTransitionId();
+}
+
+void ASVSRoom::BakeRoomTransitionId()
+{
+	if (RoomTransitionId <= 0)
+	{ return; }
+
+	/** Components which do not follow the timeline keep an ID of zero so they never match a slot */
+	for (int32 ComponentIndex = 0; ComponentIndex < VanishParameterBlock.Components.Num(); ComponentIndex++)
+	{
+		if (UPrimitiveComponent* Component = VanishParameterBlock.Components[ComponentIndex])
+		{
+			Component->SetCustomPrimitiveDataFloat(
+				RoomTransitionIdDataIndex,
+				VanishParameterBlock.ComponentFollowsVisibility[ComponentIndex] ? static_cast<float>(RoomTransitionId) : 0.0f);
+		}
+	}
+}
+
+void ASVSRoom::AcquireRoomTransitionSlot()
+{
+	if (RoomTransitionSlot != INDEX_NONE || !IsValid(RoomManager))
+	{ return; }
+
+	RoomTransitionSlot = RoomManager->AcquireRoomTransitionSlot(RoomTransitionId);
+}
+
+void ASVSRoom::ReleaseRoomTransitionSlot()
+{
+	if (RoomTransitionSlot == INDEX_NONE)
+	{ return; }
 	
+	if (IsValid(RoomManager))
+	{ RoomManager->ReleaseRoomTransitionSlot(RoomTransitionSlot); }
+	RoomTransitionSlot = INDEX_NONE;
+	VanishParameterBlock.bDirty = true;
+	FlushVanishParameterBlock();
 }
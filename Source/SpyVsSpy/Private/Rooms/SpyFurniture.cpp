@@ -7,6 +7,7 @@
 #include "Components/ShapeComponent.h"
 #include "Rooms/FurnitureInteractionComponent.h"
 #include "Items/InventoryComponent.h"
+#include "GameModes/SpyItemWorldSubsystem.h"
 
 ASpyFurniture::ASpyFurniture()
 {
@@ -35,6 +36,18 @@ void ASpyFurniture::BeginPlay()
 	/** Add delegates for Overlaps */
 	OnActorBeginOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapBegin);
 	OnActorEndOverlap.AddUniqueDynamic(this, &ThisClass::OnOverlapEnd);
+
+	/** Let the item subsystem know this furniture can hold items */
+	if (USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>())
+	{ SpyItemWorldSubsystem->RegisterSpyFurniture(this); }
+}
+
+void ASpyFurniture::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USpyItemWorldSubsystem* SpyItemWorldSubsystem = GetWorld()->GetSubsystem<USpyItemWorldSubsystem>())
+	{ SpyItemWorldSubsystem->UnregisterSpyFurniture(this); }
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASpyFurniture::OnOverlapBegin(AActor* OverlappedActor, AActor* OtherActor)
@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "SpyItemPreloadManifest.generated.h"
+
+/** Items a map requests through LoadSpyItemAssets */
+USTRUCT(BlueprintType, Category = "SVS|ItemAssets")
+struct FSpyItemPreloadMapEntry
+{
+	GENERATED_BODY()
+
+	/** Long package name of the map, ex: /Game/SvS/Assets/AddOn/Maps/VersusModeLevel1 */
+	UPROPERTY(Config, EditAnywhere, Category = "SVS|ItemAssets")
+	FName MapPackageName;
+
+	UPROPERTY(Config, EditAnywhere, Category = "SVS|ItemAssets")
+	TArray<FPrimaryAssetId> ItemAssetIds;
+};
+
+/**
+ * Per map item preload manifest written by the SpyItemPreloadManifest commandlet so the
+ * item subsystem can start loading while the map is still being set up
+ */
+UCLASS(Config = Game, DefaultConfig)
+class SPYVSSPY_API USpyItemPreloadManifest : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(Config, EditAnywhere, Category = "SVS|ItemAssets")
+	TArray<FSpyItemPreloadMapEntry> MapItemManifests;
+
+	/**
+	 * @param InMapPackageName Long package name of the map without a PIE prefix
+	 * @return Manifest entry of the map or nullptr if the map has none
+	 */
+	const FSpyItemPreloadMapEntry* FindMapEntry(const FName InMapPackageName) const;
+};
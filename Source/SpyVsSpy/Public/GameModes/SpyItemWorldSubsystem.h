@@ -7,7 +7,13 @@
 #include "SpyItemWorldSubsystem.generated.h"
 
 
+class ASpyCharacter;
 class ASpyFurniture;
+class UInventoryBaseAsset;
+struct FStreamableHandle;
+
+/** Notify listeners such as the game mode that every requested item asset type has finished loading */
+DECLARE_MULTICAST_DELEGATE(FOnAllItemAssetsLoaded);
 
 USTRUCT(BlueprintType, Category = "SVS|ItemAssets")
 struct FSpyItemAssetType
@@ -18,13 +24,48 @@ struct FSpyItemAssetType
 
 	int ItemAssetsOfTypeTotal;
 
+	/** Requested Ids, registry arrays are filled in the same order once loaded */
+	TArray<FPrimaryAssetId> ItemAssetIds;
+	/** Registry of loaded assets of the type and their matching Primary Asset Ids */
+	UPROPERTY()
+	TArray<UInventoryBaseAsset*> LoadedItemAssets;
+	TArray<FPrimaryAssetId> LoadedItemAssetIds;
+
+	/** Batched load of every requested asset of the type */
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	double LoadStartTime;
+	/** Seconds from request to completion, negative while loading */
+	double LoadDuration;
+
 	/** Constructor */
 	FSpyItemAssetType(){
 		ItemAssetType = FPrimaryAssetType();
 		ItemAssetsOfTypeTotal = 0;
+		LoadStartTime = 0.0;
+		LoadDuration = -1.0;
 	}
 };
 
+/** Seed and constraints used to place items on furniture, relaxed in order when a level cannot satisfy them */
+USTRUCT(BlueprintType, Category = "SVS|ItemAssets")
+struct FSpyItemDistributionSettings
+{
+	GENERATED_BODY()
+
+	/** Seed for the layout, 0 picks a new seed each match. The seed used is logged so a layout can be replayed */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "SVS|ItemAssets")
+	int32 Seed = 0;
+	/** Place at most one item in each room */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "SVS|ItemAssets")
+	bool bOneItemPerRoom = true;
+	/** Minimum number of doors between an item and every spy spawn */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta = (ClampMin = 0), Category = "SVS|ItemAssets")
+	int32 MinRoomHopsFromSpawns = 2;
+	/** Maximum difference between the closest TeamA spawn and the closest TeamB spawn to an item, in doors */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta = (ClampMin = 0), Category = "SVS|ItemAssets")
+	int32 MaxTeamRoomHopImbalance = 1;
+};
+
 /**
  * This class is a singleton which handles the loading/unloading of items
  * locally (for both server and clients).  The class acts as an Spy Item
@@ -52,6 +93,56 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SVS|ItemAssets")
 	bool AllItemsVerifiedLoaded() const { return bAllItemAssetsLoaded; }
+	/** Broadcast once all requested item asset types are loaded and verified */
+	FOnAllItemAssetsLoaded OnAllItemAssetsLoaded;
+
+	/**
+	 * @param InAssetType The Type for the PrimaryAssetIds being loaded
+	 * @return Load progress of the type from 0 to 1, 0 if the type has not been requested
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|ItemAssets")
+	float GetItemAssetTypeLoadProgress(const FPrimaryAssetType InAssetType) const;
+	/** @return Load progress of all requested types from 0 to 1 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|ItemAssets")
+	float GetAllItemAssetsLoadProgress() const;
+
+	/**
+	 * @param InAssetType The Type of Item Assets
+	 * @return Loaded Item Assets of the type, empty until the type has loaded
+	 */
+	const TArray<UInventoryBaseAsset*>& GetLoadedItemAssets(const FPrimaryAssetType& InAssetType) const;
+	/** @return Primary Asset Ids of the loaded Item Assets of the type */
+	const TArray<FPrimaryAssetId>& GetLoadedItemAssetIds(const FPrimaryAssetType& InAssetType) const;
+
+	/** Handle of items which are not in the registry */
+	static constexpr uint8 InvalidItemHandle = MAX_uint8;
+	/**
+	 * @brief Handing out a handle freezes the registry as the handle is about to be replicated
+	 * @param InItemAssetId Primary Asset Id of a loaded item
+	 * @return Compact handle for the item, identical on server and clients, or InvalidItemHandle
+	 */
+	uint8 GetItemHandle(const FPrimaryAssetId& InItemAssetId);
+	/**
+	 * @brief Resolving a replicated handle freezes the registry
+	 * @param InItemHandle Handle assigned by GetItemHandle
+	 * @return Item Asset for the handle or nullptr if the registry does not have it
+	 */
+	UInventoryBaseAsset* GetItemAssetByHandle(const uint8 InItemHandle);
+	/** @return Checksum of the sorted item ids behind the handles, 0 until the registry is frozen */
+	uint32 GetItemHandleRegistryChecksum() const { return bItemHandleRegistryFrozen ? ItemHandleRegistryChecksum : 0; }
+	/** Clients compare their registry with the server's replicated checksum once both are known */
+	void VerifyItemHandleRegistryChecksum() const;
+
+	/** Item holders register themselves so distribution never iterates the world */
+	void RegisterSpyCharacter(ASpyCharacter* InSpyCharacter);
+	void UnregisterSpyCharacter(ASpyCharacter* InSpyCharacter);
+	void RegisterSpyFurniture(ASpyFurniture* InSpyFurniture);
+	void UnregisterSpyFurniture(ASpyFurniture* InSpyFurniture);
+
+	/** Item asset bundles holding data gameplay needs, loaded everywhere */
+	static const FName GameplayAssetBundle;
+	/** Item asset bundles holding meshes, effects and sounds, skipped by dedicated servers */
+	static const FName CosmeticAssetBundle;
 
 	/**
 	 * @brief Server only method to place items on furniture actors
@@ -61,21 +152,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SVS|ItemAssets")
 	void DistributeItems(const FPrimaryAssetType& ItemToDistributeAssetType, const TSubclassOf<AActor> TargetActorClass);
 
+	/**
+	 * @brief Server only method to set the seed and constraints for the following distributions
+	 * @param InItemDistributionSettings Settings to use, a seed of 0 is replaced with a new seed which is logged
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|ItemAssets")
+	void SetItemDistributionSettings(const FSpyItemDistributionSettings& InItemDistributionSettings);
+	/** @return Seed used for the current item layout */
+	UFUNCTION(BlueprintPure, Category = "SVS|ItemAssets")
+	int32 GetItemDistributionSeed() const { return ItemDistributionSettings.Seed; }
+
 protected:
 
 	/** Class Overrides */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 	virtual void Deinitialize() override;
 
 #pragma region="AssetManagerWrapper"
 	UPROPERTY(VisibleAnywhere, Category = "SVS|AssetManager")
 	UAssetManager* AssetManager;
+
+	/** Bundles requested with every item asset, cosmetics are left out on dedicated servers */
+	TArray<FName> ItemAssetBundles;
+
+	/** Start loading the items listed for this map in the preload manifest before the world begins play */
+	void LoadManifestItemAssets();
 	
-	/** Request Load Asset from Asset Manager */
-	void LoadItemAssetFromAssetId(const FPrimaryAssetId& InItemAssetId, const FPrimaryAssetType& InAssetType);
+	/** Asset Manager Async Load Delegate, one per requested type, fills the type's registry */
+	void OnItemAssetTypeLoaded(const FPrimaryAssetType InAssetType);
+	/** Runs once every requested type has filled its registry */
+	void OnAllItemAssetTypesLoaded();
 
-	/** Asset Manager Async Load Delegate */
-	void OnItemAssetLoadFromAssetId(const FPrimaryAssetId InItemAssetId);
+	/** Combines the load handles of every requested type for load progress */
+	TSharedPtr<FStreamableHandle> AllItemAssetsLoadHandle;
+	/** Replace the combined handle so it covers every requested type */
+	void UpdateAllItemAssetsLoadHandle();
 
 	// TODO remove
 	//TArray<UInventoryBaseAsset*> ItemRegistry;
@@ -88,13 +200,46 @@ protected:
 	// TODO maintain load success state, bool GetLoadSuccess(), run are
 	// all assetsload for each load run
 	// TODO Use a deinit override to cleanup values and loaded assets from asset manager
-	/** Value field is the total number of assets to check of type defined by the Map Key Value */
-	TMap<FPrimaryAssetType, int32> TotalAssetsRequestedToLoadPerTypeMap;
+	/** Requested item asset types with their load handle, totals, timing and registry of loaded assets */
+	UPROPERTY()
+	TMap<FPrimaryAssetType, FSpyItemAssetType> ItemAssetTypesRequested;
 	bool bAllItemAssetsLoaded = false;
-	int32 TotalItemsRequested = 0;
-	int TotalObjectsRequestedForLoad;
-	int32 TotalItemsRequestedAndLoaded = 0;
 #pragma endregion="ItemLoadVerification"
+
+#pragma region="ItemHandles"
+	/** Loaded items of every type indexed by handle */
+	UPROPERTY()
+	TArray<UInventoryBaseAsset*> ItemHandleRegistry;
+	TMap<FPrimaryAssetId, uint8> ItemHandlesByAssetId;
+	/** The registry is rebuilt as types load until a handle is first used, it is never renumbered after that */
+	bool bItemHandleRegistryFrozen = false;
+	uint32 ItemHandleRegistryChecksum = 0;
+	/** Assign handles by sorted Primary Asset Id so every machine which loaded the same items agrees on them */
+	void BuildItemHandleRegistry();
+	/** Stop renumbering handles, publish the checksum on the server or verify it on clients */
+	void FreezeItemHandleRegistry();
+#pragma endregion="ItemHandles"
+
+#pragma region="ItemHolders"
+	UPROPERTY()
+	TArray<ASpyCharacter*> SpyCharacterCollection;
+	UPROPERTY()
+	TArray<ASpyFurniture*> SpyFurnitureCollection;
+#pragma endregion="ItemHolders"
+
+#pragma region="ItemDistribution"
+	FSpyItemDistributionSettings ItemDistributionSettings;
+	/** All distribution randomness is drawn from this stream so a seed reproduces the layout */
+	FRandomStream ItemDistributionStream;
+	bool bItemDistributionSeeded = false;
+
+	/**
+	 * @brief Place each item on a furniture candidate, relaxing team balance, spawn distance and then one item per room
+	 * until every item is placed. Runs in linear time over the candidates and items.
+	 * @param InItemAssetIds Items to place
+	 */
+	void DistributeItemsToFurniture(const TArray<FPrimaryAssetId>& InItemAssetIds);
+#pragma endregion="ItemDistribution"
 	
 	// UFUNCTION(BlueprintCallable, NetMulticast, Reliable, Category = "SVS|ItemAssets")
 	// void NM_DistributeItem(const ASpyFurniture* InSpyFurniture, const FPrimaryAssetId& ItemToDistributePrimaryAssetId);
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameModes/SpyItemWorldSubsystem.h"
 #include "GameModes/SpyVsSpyGameState.h"
 #include "Players/SpyPlayerState.h"
 #include "GameFramework/GameMode.h"
@@ -18,6 +19,7 @@ class ASpyVsSpyGameMode : public AGameMode
 
 public:
 	ASpyVsSpyGameMode();
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 	virtual void BeginPlay() override;
 	virtual void RestartPlayer(AController* NewPlayer) override;
 	virtual void RestartGame() override; // TODO review to see if controller resets are needed
@@ -55,9 +57,15 @@ protected:
 	FPrimaryAssetType SpyWeaponItemTypeToDistributed = FName("InventoryWeaponAsset");
 	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, meta = (AllowPrivateAccess), Category = "SVS|GameMode")
 	FPrimaryAssetType SpyTrapItemTypeToDistributed = FName("InventoryTrapAsset");
+	/** Seed and constraints for placing mission items, the seed can be overridden with the ?ItemSeed= URL option */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, meta = (AllowPrivateAccess), Category = "SVS|GameMode")
+	FSpyItemDistributionSettings ItemDistributionSettings;
 	
 	UPROPERTY(BlueprintReadOnly, VisibleInstanceOnly, meta = (AllowPrivateAccess), Category = "SVS|GameMode")
 	ARoomManager* RoomManager;
+	/** Class of Room Manager to spawn, allows maps to select room manager settings such as occupancy tracking */
+	UPROPERTY(EditDefaultsOnly, NoClear, Category = "SVS|GameMode")
+	TSubclassOf<ARoomManager> RoomManagerClass;
 
 private:
 
@@ -93,6 +101,10 @@ private:
 	void AttemptStartGame();
 	void DisplayCountDown();
 	void StartGame();
+	/** Place mission items in furniture and give spies their weapons and traps, requires item assets to be loaded */
+	void DistributeSpyItems();
+	/** Distribute items then start the match so spies never start with empty inventories or leave their spawn rooms first */
+	void DistributeSpyItemsAndStartMatch();
 
 	bool CheckAllPlayersStatus(const EPlayerGameStatus StateToCheck) const;
 };
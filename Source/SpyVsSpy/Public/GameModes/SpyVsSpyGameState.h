@@ -108,6 +108,10 @@ public:
 	ASpyVsSpyGameState();
 	
 	ARoomManager* GetRoomManager() const;
+
+	/** Server only, publish the item handle registry checksum for clients to verify their handles against */
+	void SetItemHandleRegistryChecksum(const uint32 InItemHandleRegistryChecksum);
+	uint32 GetItemHandleRegistryChecksum() const { return ItemHandleRegistryChecksum; }
 	
 	/** Class Overrides */
 	virtual void BeginPlay() override;
@@ -220,6 +224,12 @@ private:
 	TArray<FGameResult> Results;
 	UFUNCTION()
 	void OnRep_ResultsUpdated();
+
+	/** Checksum of the server's sorted item ids, clients with a different checksum assign different item handles */
+	UPROPERTY(VisibleAnywhere, ReplicatedUsing = OnRep_ItemHandleRegistryChecksum, Category = "SVS|GameState|Items")
+	uint32 ItemHandleRegistryChecksum = 0;
+	UFUNCTION()
+	void OnRep_ItemHandleRegistryChecksum() const;
 	
 	/** Check if all results are in then let clients know the final results */
 	void TryFinaliseScoreBoard();
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "InventoryComponent.generated.h"
 
 enum class EWeaponType : uint8;
@@ -14,6 +15,9 @@ class UInventoryTrapAsset;
 class UInventoryItemComponent;
 class UInventoryBaseAsset;
 class AWeapon;
+class UInventoryComponent;
+class USpyItemWorldSubsystem;
+struct FInventoryItemList;
 
 DECLARE_MULTICAST_DELEGATE(FOnInventoryUpdated);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnEquippedUpdated);
@@ -37,6 +41,47 @@ enum class EItemRotationDirection : uint8
 	Next			UMETA(DisplayName = "Next Item")
 };
 
+/** Replicated inventory entry, only added and removed entries are sent to clients */
+USTRUCT()
+struct FInventoryItemEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Handle assigned by the Spy Item Subsystem */
+	UPROPERTY()
+	uint8 ItemHandle = MAX_uint8;
+
+	void PostReplicatedAdd(const FInventoryItemList& InArraySerializer);
+	void PreReplicatedRemove(const FInventoryItemList& InArraySerializer);
+};
+
+USTRUCT()
+struct FInventoryItemList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FInventoryItemEntry> Items;
+
+	/** Inventory to notify of replicated changes */
+	UPROPERTY(NotReplicated)
+	UInventoryComponent* OwnerComponent = nullptr;
+
+	bool ContainsItemHandle(const uint8 InItemHandle) const;
+
+	/** Refresh the inventory once per replication update rather than once per item */
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{ return FFastArraySerializer::FastArrayDeltaSerialize<FInventoryItemEntry, FInventoryItemList>(Items, DeltaParms, *this); }
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventoryItemList> : public TStructOpsTypeTraitsBase2<FInventoryItemList>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SPYVSSPY_API UInventoryComponent : public UActorComponent
 {
@@ -46,6 +91,7 @@ public:
 
 	UInventoryComponent();
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory")
 	EInventoryOwnerType GetInventoryOwnerType() const { return InventoryOwnerType; }
@@ -56,16 +102,21 @@ public:
 	FOnEquippedUpdated OnEquippedUpdated;
 	
 	/**
-	 * @brief Standard way to add assets to inventory as this list replicates to clients and
-	 * clients then load assets from asset manager
+	 * @brief Standard way to add assets to inventory, the ids are replicated to clients as item handles
+	 * which clients resolve through the Spy Item Subsystem
 	 * @param InPrimaryAssetIdsToLoad 
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory")
 	void SetPrimaryAssetIdsToLoad(TArray<FPrimaryAssetId>& InPrimaryAssetIdsToLoad);
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory")
 	bool AddInventoryItems(TArray<FPrimaryAssetId>& PrimaryAssetIdCollectionToLoad);
+	/**
+	 * @brief Server only method to remove an item, clients are sent only the removed entry
+	 * @param InInventoryAsset Item to remove
+	 * @return True if the inventory held the item
+	 */
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory")
-	bool RemoveInventoryItem(UInventoryItemComponent* InInventoryItem);
+	bool RemoveInventoryItem(UInventoryBaseAsset* InInventoryAsset);
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory")
 	void GetInventoryItems(TArray<UInventoryBaseAsset*>& InInventoryItems) const;
 
@@ -77,6 +128,8 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory")
 	UInventoryTrapAsset* GetRiggedTrapAsset() const { return RiggedTrapAsset; }
+	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory|Combat")
+	AWeapon* GetEquippedWeapon() const { return CurrentSpawnedWeapon.Get(); }
 
 	/**
 	 * @brief Set the owner of this inventory to have a rigged trap which activates upon interaction
@@ -101,8 +154,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory|Combat")
 	void ResetEquipped();
 
+	/**
+	 * Server only, clients have no use for weapon sweeps as hits are decided and effects are triggered by the server
+	 * @param InMontagePosition Montage time the attack phase changed at, negative to use the montage position of this tick
+	 */
 	UFUNCTION(BlueprintCallable, Category = "SVS|Inventory|Combat")
-	void EnableWeaponAttackPhase(const bool bEnableAttackPhase);
+	void EnableWeaponAttackPhase(const bool bEnableAttackPhase, const float InMontagePosition = -1.0f);
 
 protected:
 
@@ -114,13 +171,26 @@ protected:
 
 	TArray<TTuple<int8, uint8, bool>> ItemsCollection;
 
-	UPROPERTY(BlueprintReadOnly, EditAnywhere, meta = (AllowPrivateAccess), ReplicatedUsing = OnRep_PrimaryAssetIdsToLoad, Category = "SVS|Inventory")
-	TArray<FPrimaryAssetId> PrimaryAssetIdsToLoad;
-	UFUNCTION()
-	void OnRep_PrimaryAssetIdsToLoad();
+	/** Item handles assigned by the Spy Item Subsystem, a byte per item instead of a Primary Asset Id */
+	UPROPERTY(Replicated)
+	FInventoryItemList InventoryItemList;
+
+	/** Called for each entry added or removed, on the server directly and on clients by replication */
+	void OnInventoryItemAdded(const uint8 InItemHandle);
+	void OnInventoryItemRemoved(const uint8 InItemHandle);
+	/** Called on clients once a replication update has been applied */
+	void OnInventoryItemsReplicated();
+	friend struct FInventoryItemEntry;
+	friend struct FInventoryItemList;
+
+	/** @return Item subsystem if it has loaded all items, otherwise waits for it to finish loading */
+	USpyItemWorldSubsystem* GetLoadedItemWorldSubsystem();
+	/** Entries which replicated before item assets loaded are resolved here */
+	void OnItemAssetsLoaded();
 	
 	UFUNCTION()
 	void LoadInventoryAssetFromAssetId(const FPrimaryAssetId& InInventoryAssetId);
+	void AddInventoryAsset(UInventoryBaseAsset* InInventoryAsset);
 
 private:
 
@@ -154,9 +224,22 @@ private:
 	
 	/** References to equipped weapon actor */
 	TWeakObjectPtr<AWeapon> CurrentSpawnedWeapon;
+
+	/** Local pool on every machine with one attached weapon per weapon asset held, equipping toggles them instead of spawning */
+	UPROPERTY()
+	TMap<const UInventoryWeaponAsset*, AWeapon*> WeaponPool;
+	/** @return Pooled weapon for the asset, spawned and attached inactive if the pool does not have one yet */
+	AWeapon* GetPooledWeapon(const UInventoryWeaponAsset* WeaponAsset);
+	void ReleasePooledWeapon(const UInventoryWeaponAsset* WeaponAsset);
 	/** References to equipped trap mesh component */
 	TWeakObjectPtr<UTrapMeshComponent> CurrentHeldTrap;
 
+	/** Client side held trap components, hidden ones are free for the next equip */
+	UPROPERTY()
+	TArray<UTrapMeshComponent*> HeldTrapPool;
+	/** @return Free held trap component attached to the trap hand, created if every pooled one is in use */
+	UTrapMeshComponent* GetPooledHeldTrap();
+
 	/** Data Asset pertaining to the current Equipped Item */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta = (AllowPrivateAccess), Category = "SVS|Inventory")
 	UInventoryBaseAsset* EquippedItemAsset;
@@ -10,7 +10,8 @@
 enum class EInventoryOwnerType : uint8;
 
 /**
- * 
+ * Meshes, animations, effects and sounds are soft references in the Cosmetic asset bundle
+ * which dedicated servers do not load, see USpyItemWorldSubsystem::CosmeticAssetBundle
  */
 UCLASS()
 class SPYVSSPY_API UInventoryTrapAsset : public UInventoryBaseAsset
@@ -28,16 +29,16 @@ public:
 	FTransform TrapEffectTransformOffset;
 
 	/** Static Mesh for Trap */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, meta = (AllowPrivateAccess), Category = "SVS|Inventory|Trap")
-	UStaticMesh* TrapMesh;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, meta = (AllowPrivateAccess, AssetBundles = "Cosmetic"), Category = "SVS|Inventory|Trap")
+	TSoftObjectPtr<UStaticMesh> TrapMesh;
 	
 	/** Attach Transform for Weapon Actor */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap")
 	FTransform HeldTrapAttachTransform;
 
 	/** Animation for Character Victim Death Resulting from triggering this trap */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap")
-	UAnimMontage* CharacterDeathAnimation;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<UAnimMontage> CharacterDeathAnimation;
 
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap")
 	float TrapBaseDamage = 0.0f;
@@ -57,16 +58,16 @@ public:
 	UGameplayCueNotify_Static* DamageGameplayCueNotify;
 
 	/** Visual effect of the trap interacting with victim */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap")
-	UNiagaraSystem* TrapDamageVisualEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<UNiagaraSystem> TrapDamageVisualEffect;
 
 	/** Visual effect of the trap interacting with victim with fatal result */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap")
-	UNiagaraSystem* TrapFatalDamageVisualEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<UNiagaraSystem> TrapFatalDamageVisualEffect;
 
 	/** Sound of the Trap interacting with victim */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap")
-	USoundCue* TrapTriggeredSoundEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<USoundCue> TrapTriggeredSoundEffect;
 
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Trap", meta = (Categories = "GameplayCue"))
 	FGameplayTag GameplayTriggerTag;
@@ -20,13 +20,42 @@ enum class EWeaponType : uint8
 	Club UMETA(DisplayName = "Club"),
 };
 
+/** How the server decides whether an attack with the weapon hit an opponent */
+UENUM(BlueprintType)
+enum class EWeaponHitDetectionMode : uint8
+{
+	/**
+	 * Sweep the weapon mesh, the server approximates the mesh with capsules fitted to its physics asset bodies,
+	 * boxes become a capsule along their longest axis and a mesh without a physics asset uses its bounds box
+	 */
+	ComponentSweep UMETA(DisplayName = "Component Sweep"),
+	/** Analytic tests of the asset's attack capsules against character hit capsules */
+	AttackVolumes UMETA(DisplayName = "Attack Volumes"),
+};
+
+/** Capsule described by the segment between two points and a radius */
+USTRUCT(BlueprintType)
+struct FWeaponAttackCapsule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
+	FVector Start = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
+	FVector End = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (ClampMin = "0.0"))
+	float Radius = 5.0f;
+};
+
 class USoundCue;
 class UNiagaraSystem;
 class UWeaponComponent;
 class UGameplayCueNotify_Static;
 
 /**
- * 
+ * Effects, sounds and the victim death animation are soft references in the Cosmetic asset bundle
+ * which dedicated servers do not load. The weapon mesh and attack animation stay hard references
+ * as the server sweeps the mesh and relies on the attack montage notifies
  */
 UCLASS()
 class SPYVSSPY_API UInventoryWeaponAsset : public UInventoryBaseAsset
@@ -52,8 +81,8 @@ public:
 	UAnimMontage* CharacterAttackAnimation;
 
 	/** Animation for Character Victim Death Resulting from this weapon inflicting the final blow */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
-	UAnimMontage* CharacterDeathAnimation;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<UAnimMontage> CharacterDeathAnimation;
 
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
 	float WeaponAttackBaseDamage = 0.0f;
@@ -69,28 +98,36 @@ public:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
 	EWeaponType WeaponType = EWeaponType::None;
 
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
+	EWeaponHitDetectionMode HitDetectionMode = EWeaponHitDetectionMode::ComponentSweep;
+
+	/** One or two capsules relative to the hand socket the weapon attaches to, e.g. handle and head of a club */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat",
+		meta = (EditCondition = "HitDetectionMode == EWeaponHitDetectionMode::AttackVolumes"))
+	TArray<FWeaponAttackCapsule> AttackCapsules;
+
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
 	UGameplayCueNotify_Static* DamageGameplayCueNotify;
 
 	/** Visual effect for the action of using the weapon */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
-	UNiagaraSystem* AttackVisualEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<UNiagaraSystem> AttackVisualEffect;
 
 	/** Visual effect of the weapon interacting with victim */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
-	UNiagaraSystem* AttackDamageVisualEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<UNiagaraSystem> AttackDamageVisualEffect;
 
 	/** Visual effect of the weapon interacting with victim with fatal result */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
-	UNiagaraSystem* AttackFatalDamageVisualEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<UNiagaraSystem> AttackFatalDamageVisualEffect;
 
 	/** Sound for the action of using the weapon */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
-	USoundCue* AttackSoundEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<USoundCue> AttackSoundEffect;
 
 	/** Sound of the weapon interacting with victim */
-	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat")
-	USoundCue* AttackDamageSoundEffect;
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (AssetBundles = "Cosmetic"))
+	TSoftObjectPtr<USoundCue> AttackDamageSoundEffect;
 
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "SVS|Inventory|Combat", meta = (Categories = "GameplayCue" ))
 	FGameplayTag GameplayTriggerTag;
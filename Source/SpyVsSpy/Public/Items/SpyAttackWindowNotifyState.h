@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "SpyAttackWindowNotifyState.generated.h"
+
+/**
+ * Opens and closes the owning spy's primary attack window at the notify's montage times,
+ * the weapon sweeps from those times rather than from the tick the notify fired in
+ */
+UCLASS(meta = (DisplayName = "Spy Attack Window"))
+class SPYVSSPY_API USpyAttackWindowNotifyState : public UAnimNotifyState
+{
+	GENERATED_BODY()
+
+public:
+
+#pragma region="ClassOverrides"
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual FString GetNotifyName_Implementation() const override { return TEXT("Spy Attack Window"); }
+#pragma endregion="ClassOverrides"
+	
+};
@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpyAttackWindowSubsystem.generated.h"
+
+class AWeapon;
+
+/**
+ * Owns the open attack windows of every weapon in the world and sweeps them in a single tick,
+ * weapons themselves never tick so only weapons mid attack cost anything per frame
+ */
+UCLASS()
+class SPYVSSPY_API USpyAttackWindowSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Start sweeping the weapon each frame until its attack window is closed */
+	void OpenAttackWindow(AWeapon* InWeapon);
+	void CloseAttackWindow(AWeapon* InWeapon);
+
+	UFUNCTION(BlueprintCallable, Category = "SVS|Abilities|Combat")
+	int32 GetNumActiveAttackWindows() const { return ActiveAttackWindowWeapons.Num(); }
+
+#pragma region="ClassOverrides"
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !ActiveAttackWindowWeapons.IsEmpty(); }
+	virtual TStatId GetStatId() const override;
+#pragma endregion="ClassOverrides"
+
+protected:
+	
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	UPROPERTY()
+	TArray<AWeapon*> ActiveAttackWindowWeapons;
+	
+};
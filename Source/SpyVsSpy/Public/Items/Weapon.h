@@ -8,6 +8,8 @@
 #include "Weapon.generated.h"
 
 class USkeletalMeshComponent;
+class ASpyCharacter;
+class UAnimMontage;
 
 UCLASS()
 class SPYVSSPY_API AWeapon : public AActor
@@ -17,10 +19,6 @@ class SPYVSSPY_API AWeapon : public AActor
 public:	
 	// Sets default values for this actor's properties
 	AWeapon();
-	// TODO refactor into base virtual class
-	virtual void Tick(float DeltaTime) override;
-
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	/** Loads property values from the data asset assigned to the instance of this class
 	* @return Whether Loading was Successful or Not */
@@ -30,34 +28,92 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SVS|Weapon")
 	USkeletalMeshComponent* GetMesh() const { return SkeletalMeshComponent; }
 	
-	/** Enable Components sweeps to be performed on tick */
-	void EnableOnTickComponentSweeps(const bool bEnable);
+	/**
+	 * Enable Components sweeps to be performed on tick, opens an attack window with the Attack Window Subsystem
+	 * @param InMontagePosition Montage time the window opened or closed at, sweeps start or stop there rather than at a tick
+	 */
+	void EnableOnTickComponentSweeps(const bool bEnable, const float InMontagePosition = -1.0f);
+	bool IsAttackWindowOpen() const { return bEnableOnTickComponentSweeps; }
+	/** Called by the Attack Window Subsystem for each frame the attack window is open */
+	void SweepWeapon();
 
 	UFUNCTION()
 	void UpdateCollisionChannelResponseToBlock(const ECollisionChannel EnemyObjectChannel, const ECollisionChannel SelfObjectChannel);
 
+	/**
+	 * @brief Take a pooled weapon in or out of the owner's hand, called on each machine by the owner's inventory,
+	 * inactive weapons stay attached but are hidden, do not collide and do not sweep
+	 * @param bInWeaponActive Whether the weapon is the equipped weapon
+	 */
+	void SetWeaponActive(const bool bInWeaponActive);
+	UFUNCTION(BlueprintCallable, Category = "SVS|Weapon")
+	bool IsWeaponActive() const { return bWeaponActive; }
+	/** Apply visibility from the active state and the owner's visibility */
+	void UpdateWeaponVisibility();
+	/** Whether the server tests the data asset's capsules instead of sweeping the weapon mesh */
+	bool UsesAttackVolumes() const { return HitDetectionMode == EWeaponHitDetectionMode::AttackVolumes && !AttackCapsules.IsEmpty(); }
+
 
 private:
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	/** Whether we perform Component Sweeps on Tick */
-	UPROPERTY(ReplicatedUsing="OnRep_bEnableOnTickComponentSweeps")
+	/** Whether we perform Component Sweeps on Tick, driven on the server by the owner's inventory */
+	UPROPERTY()
 	bool bEnableOnTickComponentSweeps = false;
-	void SweepWeapon();
-
-	/** This allows clients to perform ComponentSweep as well for cosmetic effects */
-	UFUNCTION()
-	void OnRep_bEnableOnTickComponentSweeps();
+	/** Sweeps each fixed sub step of montage time elapsed since the previous tick */
+	void SweepWeaponSubSteps(ASpyCharacter* InSpyCharacter, const UAnimMontage* InMontage, const float InMontagePosition, const float InPlayRate, const double InServerTime);
+	/**
+	 * Sweep from the previous sample to the weapon placed at the given transforms
+	 * @return Whether a hit was handled
+	 */
+	bool SweepWeaponSample(ASpyCharacter* InSpyCharacter, const FTransform& InWeaponTransform, const FTransform& InSocketTransform, const double InSampleServerTime);
+
+	/** Montage time between weapon sweep samples, scaled by montage play rate */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Weapon", meta = (ClampMin = "0.001"))
+	float AttackSubStepSeconds = 1.0f / 60.0f;
+	/** Guards against long hitches producing a burst of samples in one tick */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Weapon", meta = (ClampMin = "1"))
+	int32 MaxAttackSubStepsPerTick = 16;
+	TWeakObjectPtr<const UAnimMontage> SweepMontage;
+	float LastSweepMontagePosition = -1.0f;
+	FTransform LastSweepMeshTransform = FTransform::Identity;
+
+	/** Sweep from the previous tick's sample to the montage time a notify closed the window at */
+	void SweepToClosingMontagePosition(const float InMontagePosition);
+	/** Reset sweep samples and open or close the attack window, see EnableOnTickComponentSweeps */
+	void ApplyOnTickComponentSweeps(const float InMontagePosition);
 
 	FVector OnComponentSweepEnableStartLocation = FVector::ZeroVector;
+
+	/**
+	 * Server sweeps test capsules against rewound opponent poses
+	 * @param InLocalCapsules Capsules relative to InTransform
+	 * @param InTransform Sampled hand socket for attack volumes, sampled weapon mesh for the component sweep
+	 * @param OutWorldCapsules Capsules at the sample plus the path their ends took since the previous sample
+	 */
+	void GetAttackVolumeCapsules(const TArray<FWeaponAttackCapsule>& InLocalCapsules, const FTransform& InTransform, TArray<FWeaponAttackCapsule, TInlineAllocator<4>>& OutWorldCapsules);
+	TArray<FVector, TInlineAllocator<2>> PreviousAttackCapsuleEnds;
+	/** Fit capsules to the weapon mesh's physics asset bodies, falling back to its bounds box */
+	void BuildMeshAttackCapsules();
+	void AddBoxAttackCapsule(const FTransform& InBoxTransform, const FVector& InHalfExtent);
+	/** Relative to the weapon mesh, used by the server for the component sweep mode */
+	TArray<FWeaponAttackCapsule> MeshAttackCapsules;
+
+	UPROPERTY()
+	EWeaponHitDetectionMode HitDetectionMode = EWeaponHitDetectionMode::ComponentSweep;
+	/** Relative to the hand socket the weapon attaches to */
+	UPROPERTY()
+	TArray<FWeaponAttackCapsule> AttackCapsules;
 	FComponentQueryParams SweepQueryParams = FComponentQueryParams::DefaultComponentQueryParams;
 
-	UPROPERTY(ReplicatedUsing="OnRep_SetMesh")
+	UPROPERTY()
 	USkeletalMesh* WeaponMesh;
-	
-	UFUNCTION()
-	void OnRep_SetMesh();
+
+	/** Pooled weapons are toggled rather than spawned and destroyed on each equip */
+	UPROPERTY()
+	bool bWeaponActive = true;
 
 	UPROPERTY(BlueprintReadWrite, meta = (AllowPrivateAccess = "true"), EditInstanceOnly, Category = "SVS|Weapon")
 	USkeletalMeshComponent* SkeletalMeshComponent;
@@ -13,6 +13,7 @@
 #include "SpyCharacter.generated.h"
 
 class UTrapMeshComponent;
+struct FWeaponAttackCapsule;
 enum class EPlayerTeam : uint8;
 class UPhysicsConstraintComponent;
 class UInventoryWeaponAsset;
@@ -28,6 +29,33 @@ class USpyAttributeSet;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCharacterDiedDelegate, ASpyCharacter*, Character);
 
+/** Server side record of where a character's collision was at a point in time */
+struct FSpyPoseSnapshot
+{
+	double ServerTime = 0.0;
+	FVector CapsuleLocation = FVector::ZeroVector;
+	FQuat CapsuleRotation = FQuat::Identity;
+	float CapsuleRadius = 0.0f;
+	float CapsuleHalfHeight = 0.0f;
+};
+
+/** Hit volume approximating a body part, relative to the character's collision capsule */
+USTRUCT(BlueprintType)
+struct FSpyHitCapsule
+{
+	GENERATED_BODY()
+
+	/** Reported as the bone name of hits on this capsule */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "SVS|Abilities|Combat")
+	FName Name = NAME_None;
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "SVS|Abilities|Combat")
+	FVector Start = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "SVS|Abilities|Combat")
+	FVector End = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "SVS|Abilities|Combat", meta = (ClampMin = "0.0"))
+	float Radius = 10.0f;
+};
+
 UCLASS()
 class SPYVSSPY_API ASpyCharacter : public ACharacter, public IAbilitySystemInterface, public ISpyCombatantInterface
 {
@@ -57,13 +85,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SVS|Abilities|Combat")
 	void ResetAttackHitFound() { bAttackHitFound = false; }
 	
+	/** @param InNotifyMontagePosition Montage time the window opened at, negative to use the montage position of this tick */
 	UFUNCTION(BlueprintCallable, Category = "SVS|Abilities|Combat")
-	void StartPrimaryAttackWindow();
+	void StartPrimaryAttackWindow(const float InNotifyMontagePosition = -1.0f);
+	/** @param InNotifyMontagePosition Montage time the window closed at, negative to stop sweeping at the previous tick */
 	UFUNCTION(BlueprintCallable, Category = "SVS|Abilities|Combat")
-	void CompletePrimaryAttackWindow();
+	void CompletePrimaryAttackWindow(const float InNotifyMontagePosition = -1.0f);
 	UFUNCTION(BlueprintCallable, Category = "SVS|Abilities|Combat")
 	void HandlePrimaryAttackHit(const FHitResult& HitResult);
 
+	/**
+	 * Server only test of weapon capsules against opponent hit capsules as the attacking client saw them
+	 * @param WorldAttackCapsules Weapon capsules in world space, segment starts are treated as the leading edge
+	 * @param InAttackServerTime Server time the weapon was at these capsules, opponents are rewound from here
+	 * @param OutHit Closest opponent hit
+	 * @return Whether an opponent was hit
+	 */
+	bool FindLagCompensatedHit(TConstArrayView<FWeaponAttackCapsule> WorldAttackCapsules, const double InAttackServerTime, FHitResult& OutHit) const;
+	/** @return False when no montage is playing */
+	bool GetActiveMontagePosition(const UAnimMontage*& OutMontage, float& OutPosition, float& OutPlayRate) const;
+	/**
+	 * Component space transform of a mesh socket sampled from a montage rather than the refreshed bones,
+	 * lets the server place attack volumes at any point of the montage without evaluating the full pose
+	 * @return False when the montage has no sequence at the position
+	 */
+	bool GetMontageSocketComponentTransform(const UAnimMontage* Montage, const float MontagePosition, const FName SocketName, FTransform& OutTransform) const;
+	/**
+	 * Pose recorded by the server at the given time, interpolated between snapshots
+	 * @return False when there is no history to rewind to
+	 */
+	bool GetPoseAtServerTime(const double InServerTime, FSpyPoseSnapshot& OutPose) const;
+
 	/**
 	 * Plays an Attack Animation
 	 * @param AttackMontage The Animation Montage to use for the attack
@@ -86,6 +138,14 @@ public:
 	void SetHeldTrapItem(UTrapMeshComponent* NewTrapMeshComponent) { HeldTrapMeshComponent = NewTrapMeshComponent; };
 
 	void InitializeEquippedItem();
+
+	/**
+	 * @brief Move the character into a room found by the Room Manager occupancy tracker
+	 * @param InTrackedRoom Room the character was sampled in
+	 */
+	void SetTrackedRoom(ASVSRoom* InTrackedRoom);
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	ASVSRoom* GetCurrentRoom() const { return CurrentRoom; }
 	
 	
 #pragma region="Team"
@@ -232,6 +292,9 @@ protected:
 #pragma region="ClassOverrides"
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
 	virtual void PossessedBy(AController* NewController) override;
 	virtual void OnRep_PlayerState() override;
 #pragma endregion="ClassOverrides"
@@ -249,13 +312,25 @@ protected:
 	void ProcessRoomChange(ASVSRoom* NewRoom);
 	/** Used to allow ProcessRoomChange to work when actor is moved by setactorlocation */
 	bool bHasTeleported = false;
+	/** Opponents become relevant to a viewer once within this many doors of the viewing spy's room,
+	 * one hop keeps a spy about to walk in already relevant. Negative disables room relevancy */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SVS|Room", meta = (AllowPrivateAccess = "true"))
+	int32 EnterRelevantRoomHops = 1;
+	/** Relevant opponents only stop replicating once further than this many doors, the gap to the enter hops
+	 * stops a spy pacing across a door from destroying and respawning its pawn and weapon pool on the viewer */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SVS|Room", meta = (AllowPrivateAccess = "true"))
+	int32 LeaveRelevantRoomHops = 2;
+	/** Viewers this spy is currently room relevant to, hysteresis state written from IsNetRelevantFor
+	 * which the net driver only calls on the game thread while gathering actors for each connection */
+	mutable TSet<TWeakObjectPtr<const AActor>> RoomRelevantViewers;
 #pragma endregion ="RoomTraversal"
 
 #pragma region ="Combat"
+	/** @param InClientServerTime The attacking client's estimate of server time when attack input was pressed */
 	UFUNCTION(BlueprintCallable, Server, Reliable, Category = "SVS|Combat")
-	void S_RequestPrimaryAttack();
+	void S_RequestPrimaryAttack(const double InClientServerTime);
 	
-	void SetAttackActive(const bool bEnabled) const;
+	void SetAttackActive(const bool bEnabled, const float InNotifyMontagePosition = -1.0f) const;
 	bool bAttackHitFound = false;
 	// TODO remove after refactor
 	// UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "SVS|Abilities|Combat")
@@ -300,6 +375,26 @@ protected:
 	void S_RequestEquipItem(const EItemRotationDirection InItemRotationDirection);
 #pragma endregion="Combat"
 
+#pragma region="LagCompensation"
+	/** Upper bound on how far back attacks may rewind opponents, limits what high ping clients can claim */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SVS|Abilities|Combat", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float MaxPoseRewindSeconds = 0.25f;
+	/** Number of server frames of pose history kept, should cover MaxPoseRewindSeconds at the server tick rate */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SVS|Abilities|Combat", meta = (AllowPrivateAccess = "true", ClampMin = "2"))
+	int32 PoseHistorySize = 32;
+	/** Body part volumes tested by attacks, the collision capsule is used when empty */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SVS|Abilities|Combat", meta = (AllowPrivateAccess = "true"))
+	TArray<FSpyHitCapsule> HitCapsules;
+
+	/** Ring buffer of server poses, PoseHistoryHead is the most recent entry */
+	TArray<FSpyPoseSnapshot> PoseHistory;
+	int32 PoseHistoryHead = INDEX_NONE;
+	void RecordPoseSnapshot();
+
+	/** How far behind the server the attacking client saw opponents for the current attack */
+	double AttackRewindSeconds = 0.0;
+#pragma endregion="LagCompensation"
+
 #pragma region="CharacterDeath"
 	UFUNCTION(BlueprintCallable, Server, Reliable, Category = "SVS|Character")
 	void S_RequestDeath();
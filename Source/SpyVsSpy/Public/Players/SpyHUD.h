@@ -56,17 +56,22 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
 	void SetGameUIAssets(const TSoftObjectPtr<UUIElementAsset> InGameUIElementsAssets);
+	/** Lightweight widget shown while Game UI Assets load asynchronously */
+	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
+	void DisplayLoadingPlaceholder();
+	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
+	void HideLoadingPlaceholder();
 	
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
 	void DisplayUI() const {  BaseUIWidget->DisplayGameModeUI(); };
 	
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
-	void ToggleDisplayGameTime(const bool bIsDisplayed) const ;
+	void ToggleDisplayGameTime(const bool bIsDisplayed);
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
-	void SetMatchTimerSeconds(const float InMatchTimerSeconds) const ;
+	void SetMatchTimerSeconds(const float InMatchTimerSeconds);
 
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
-	void DisplayMatchStartCountDownTime(const float InMatchStartCountDownTime) const ;
+	void DisplayMatchStartCountDownTime(const float InMatchStartCountDownTime);
 	
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
 	void DisplayCharacterHealth(const float InCurrentHealth, const float InMaxHealth) const;
@@ -110,6 +115,14 @@ private:
 
 	/** Network latency affects precision of the float so it is better to trim the fractional when displaying */
 	FNumberFormattingOptions FloatDisplayFormat;
+
+	/** Game time requests which arrived while the Game UI was loading, applied once its widgets exist */
+	TOptional<bool> PendingDisplayGameTime;
+	TOptional<float> PendingMatchTimerSeconds;
+	TOptional<float> PendingMatchStartCountDownTime;
+	/** World time of the countdown request so the countdown resumes with the time left */
+	float PendingMatchStartCountDownRequestTime = 0.0f;
+	void ApplyPendingGameTime();
 	
 	/** Level Specific UI */
 	UPROPERTY(VisibleInstanceOnly, Category = "SVS|UI")
@@ -150,6 +163,13 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "SVS|UI")
 	FName StartMenuUINamedSlotName = "NS_StartMenuUI";
 
+	/** Shown while UI assets load, should not reference heavy assets so that it is ready immediately */
+	UPROPERTY(VisibleInstanceOnly, Category = "SVS|UI")
+	UUIElementWidget* LoadingPlaceholderWidget;
+	/** Class - Shown while UI assets load */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|UI")
+	TSubclassOf<UUIElementWidget> LoadingPlaceholderWidgetClass;
+
 	/** Game Base UI Widget - Parent for all other UIs */
 	UPROPERTY(VisibleInstanceOnly, Category = "SVS|UI")
 	UUIElementWidget* BaseUIWidget;
@@ -16,6 +16,7 @@ class ASpyVsSpyGameState;
 enum class ESVSGameType : uint8;
 class UGameUIElementsRegistry;
 class ASpyPlayerState;
+struct FStreamableHandle;
 
 /** To Specify Which type of InputMode to Request */
 UENUM(BlueprintType)
@@ -117,7 +118,11 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "SVS|UI")
 	UGameUIElementsRegistry* GameElementsRegistry;
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
-	void UpdateHUDWithGameUIElements(const ESVSGameType InGameType) const;
+	void UpdateHUDWithGameUIElements(const ESVSGameType InGameType);
+	/** Loads the UI asset of the game type, its widget classes and the input contexts in one async request */
+	TSharedPtr<FStreamableHandle> GameUIAssetsLoadHandle;
+	double GameUIAssetsLoadStartTime = 0.0;
+	void OnGameUIAssetsLoaded(const ESVSGameType InGameType);
 	/** Level Menu Display Requests */
 	UFUNCTION(BlueprintCallable, Category = "SVS|UI")
 	void RequestDisplayLevelMenu();
@@ -138,7 +143,10 @@ protected:
 
 	/** Call to change Input Mapping Contexts for Controller */
 	UFUNCTION(BlueprintCallable, Category = "SVS|Input")
-	void SetInputContext(const TSoftObjectPtr<UInputMappingContext> InMappingContext) const;
+	void SetInputContext(const TSoftObjectPtr<UInputMappingContext> InMappingContext);
+	/** Latest requested context, applied once loaded so a slow load never overrides a newer request */
+	TSoftObjectPtr<UInputMappingContext> PendingInputMapping;
+	void ApplyPendingInputContext() const;
 	
 	/** Checks if player is allowed to input movement commands given current state of play */
 	bool CanProcessRequest() const;
@@ -84,6 +84,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SVS|Player")
 	void SetCurrentStatus(const EPlayerGameStatus PlayerGameStatus);
 
+	UFUNCTION(BlueprintPure, Category = "SVS|Player")
+	EPlayerTeam GetSpyPlayerTeam() const { return SpyPlayerTeam; }
 	void SetSpyPlayerTeam(const EPlayerTeam InSpyPlayerTeam);
 	FOnSpyTeamUpdate OnSpyTeamUpdate;
 	
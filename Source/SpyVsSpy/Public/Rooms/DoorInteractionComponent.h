@@ -14,6 +14,12 @@ UDELEGATE(Category = "SVS|Door")
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDoorOpened);
 UDELEGATE(Category = "SVS|Door")
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDoorClosed);
+/**
+ * Notify listeners such as the Room Manager that characters can or can no longer pass through the door
+ * @input Pointer to door interaction component
+ * @input bIsTraversable
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnDoorTraversableChanged, const UDoorInteractionComponent*, bool);
 
 UENUM(BlueprintType)
 enum class EDoorState
@@ -38,11 +44,18 @@ public:
 	
 	FOnDoorOpened OnDoorOpened;
 	FOnDoorClosed OnDoorClosed;
+	FOnDoorTraversableChanged OnDoorTraversableChanged;
 	
 	UFUNCTION(BlueprintCallable)
 	bool IsOpen() const { return DoorState == EDoorState::Opened; }
 	UFUNCTION(BlueprintCallable)
 	EDoorState GetDoorState() const { return DoorState; }
+	/** @return False while locked, a disabled door has no panel and leaves an open door frame */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Door")
+	bool IsTraversable() const { return DoorState != EDoorState::Locked; }
+	/** Server only, the lock is multicast to clients like opening and closing */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Door")
+	void SetDoorLocked(const bool bLocked);
 
 	/** Interact Interface Override */
 	/** @return Success Status */
@@ -64,14 +77,21 @@ private:
 	
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, meta = (AllowPrivateAccess = "true"))
 	EDoorState DoorState = EDoorState::Closed;
+	/** Traversable state last broadcast to listeners */
+	bool bBroadcastTraversable = true;
+	/** Broadcast OnDoorTraversableChanged if the door state changed traversability */
+	void UpdateDoorTraversable();
 	
 	/** Internal Methods for Door Opening / Closing */
-	/** Initiate Door Opening Sequence */
+	/** Initiate Door Opening Sequence, the opener lets clients tell whether they opened it themselves */
 	UFUNCTION(NetMulticast, Reliable)
-	void NM_OpenDoor();
+	void NM_OpenDoor(const AActor* InOpener);
 	/** Initiate Door Closing Sequence */
 	UFUNCTION(NetMulticast, Reliable)
 	void NM_CloseDoor();
+	/** Lock shuts the door straight away, unlock leaves it closed */
+	UFUNCTION(NetMulticast, Reliable)
+	void NM_SetDoorLocked(const bool bLocked);
 	// TODO Add net multicasts
 	/** Handle tasks upon door reaching Opened State */
 	void DoorOpened();
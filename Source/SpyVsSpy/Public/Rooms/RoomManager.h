@@ -8,8 +8,24 @@
 
 class ASVSRoom;
 class ADynamicRoom;
+class ASVSDynamicDoor;
+class UDoorInteractionComponent;
 class ASpyCharacter;
+class UAudioComponent;
+class UMaterialParameterCollection;
+class UMaterialParameterCollectionInstance;
 struct FGuid;
+
+/** How rooms drive the material parameters of their appear / vanish effect */
+UENUM(BlueprintType)
+enum class ERoomTransitionMode : uint8
+{
+	/** Each wall and floor component receives the effect values as Custom Primitive Data */
+	CustomPrimitiveData UMETA(DisplayName = "Custom Primitive Data"),
+	/** Animating rooms write the effect values to a slot of a Material Parameter Collection */
+	ParameterCollection UMETA(DisplayName = "Material Parameter Collection"),
+};
+
 /** Begin Delegates */
 
 /**
@@ -20,6 +36,13 @@ struct FGuid;
  */
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRoomOccupiedDelegate, const ADynamicRoom*, const ASpyCharacter*, bool);
 
+/**
+ * Notify listeners on server and clients that a room has become occupied or empty
+ * @input Pointer to room
+ * @input bIsOccupied
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FRoomOccupancyChangedDelegate, const ASVSRoom*, bool);
+
 USTRUCT()
 struct FRoomListing
 {
@@ -28,12 +51,18 @@ public:
 	ASVSRoom* Room;
 	FGuid RoomGuid;
 	bool bIsOccupied = false;
+	/** Floor plan of the room in world space, used by the room spatial index */
+	FBox2D RoomBounds;
+	/** World height of the room floor, used to separate stacked rooms */
+	float RoomFloorHeight = 0.0f;
 
 	FRoomListing()
 	{
 		Room = nullptr;
 		RoomGuid = FGuid();
 		bIsOccupied = false;
+		RoomBounds = FBox2D(ForceInit);
+		RoomFloorHeight = 0.0f;
 	}
 	
 	FRoomListing(ASVSRoom* InRoom, FGuid InGuid, bool bInIsOccupied)
@@ -41,9 +70,42 @@ public:
 		Room = InRoom;
 		RoomGuid = InGuid;
 		bIsOccupied = bInIsOccupied;
+		RoomBounds = FBox2D(ForceInit);
+		RoomFloorHeight = 0.0f;
 	}
 };
 
+/** Door between two managed rooms */
+USTRUCT()
+struct FRoomDoorListing
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	ASVSDynamicDoor* Door = nullptr;
+	/** RoomCollection indices of the rooms either side of the door */
+	int32 RoomIndexA = INDEX_NONE;
+	int32 RoomIndexB = INDEX_NONE;
+	/** Room graph edges are only followed through traversable doors */
+	bool bIsTraversable = true;
+};
+
+/** Where and when a spy recently died, used to keep respawns away from fights */
+struct FRoomRecentDeath
+{
+	int32 RoomIndex = INDEX_NONE;
+	float DeathTime = 0.0f;
+};
+
+/** Actor put to sleep by room significance and the parts of it which need to be restored */
+struct FRoomDormantActor
+{
+	TWeakObjectPtr<AActor> Actor;
+	bool bActorTickDisabled = false;
+	TArray<TWeakObjectPtr<UActorComponent>, TInlineAllocator<4>> TickDisabledComponents;
+	TArray<TWeakObjectPtr<UAudioComponent>, TInlineAllocator<2>> PausedAudioComponents;
+};
+
 UCLASS()
 class SPYVSSPY_API ARoomManager : public AActor
 {
@@ -53,23 +115,280 @@ public:
 	// Sets default values for this actor's properties
 	ARoomManager();
 	
-	UFUNCTION(Server, Reliable, Category = "SVS|Room")
+	/** Authority only, rooms are collected at BeginPlay and may also register themselves */
 	void AddRoom(ASVSRoom* InDynamicRoom, const FGuid InRoomGuid);
-	// TODO use array ref in case multiple characters are in the same room
-	UFUNCTION(Server, Reliable, Category = "SVS|Room")
+	/** Authority only, a room is occupied while any character remains in it */
 	void SetRoomOccupied(const ASVSRoom* InRoom, const bool bIsOccupied, const ASpyCharacter* PlayerCharacter);
 	UFUNCTION(Blueprintable, Category = "SVS|Room")
 	void GetRoomListingCollection(TArray<FRoomListing>& RoomListingCollection, const bool bGetOccupiedRooms);
 	
+	/** Authority only, fires for each character entering or exiting a room */
 	FRoomOccupiedDelegate OnRoomOccupied;
+	/** Fires on server and clients for each room whose occupancy changed */
+	FRoomOccupancyChangedDelegate OnRoomOccupancyChanged;
+	/** @return True if the replicated occupancy marks the room as occupied */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	bool IsRoomOccupied(const ASVSRoom* InRoom) const;
+
+	/**
+	 * @brief Find the room whose floor plan contains a world location using the room spatial index
+	 * @param InLocation World location to test, ex: a character or spawn point location
+	 * @return The room at the location or nullptr if the location is outside of all rooms
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	ASVSRoom* FindRoomAtLocation(const FVector& InLocation) const;
+	/**
+	 * @brief Find a room by its unique identifier
+	 * @param InRoomGuid Unique Room Identifier
+	 * @return The room with the identifier or nullptr if it is not managed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	ASVSRoom* FindRoomByGuid(const FGuid& InRoomGuid) const;
+	/**
+	 * @brief Find a room by its room index, the compact handle to use when replicating room references
+	 * @param InRoomIndex Room index assigned by this manager, see ASVSRoom::GetRoomIndex
+	 * @return The room with the index or nullptr if it is not managed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	ASVSRoom* GetRoomByIndex(const int32 InRoomIndex) const;
+
+	/** @return True if room occupancy is sampled by this manager rather than by room trigger overlaps */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	bool IsOccupancyTrackingEnabled() const { return bEnableOccupancyTracking; }
+	/** Stop tracking a character which is leaving play and exit it from the room it was last found in */
+	void UntrackSpyCharacter(ASpyCharacter* InSpyCharacter);
+
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	ERoomTransitionMode GetRoomTransitionMode() const { return RoomTransitionMode; }
+	/**
+	 * @brief Reserve a Material Parameter Collection slot for a room which is about to animate
+	 * @param InRoomTransitionId Room ID baked into the room's Custom Primitive Data
+	 * @return Slot index or INDEX_NONE if all slots are taken and the room should use Custom Primitive Data
+	 */
+	int32 AcquireRoomTransitionSlot(const int32 InRoomTransitionId);
+	void ReleaseRoomTransitionSlot(const int32 InSlotIndex);
+	/**
+	 * @brief Write a room's effect values to its slot
+	 * @param InSlotIndex Slot reserved by the room
+	 * @param InValues Visibility, Axis Direction and Axis
+	 */
+	void SetRoomTransitionSlotValues(const int32 InSlotIndex, const FVector& InValues) const;
+
+	/** Hop count of rooms which cannot be reached through traversable doors */
+	static constexpr uint16 UnreachableRoomDistance = MAX_uint16;
+	/** @return Number of doors to pass through between two rooms or INDEX_NONE if there is no route */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room|Graph")
+	int32 GetRoomDistance(const ASVSRoom* InFromRoom, const ASVSRoom* InToRoom) const;
+	/**
+	 * @brief Find the shortest route between two rooms through traversable doors
+	 * @param OutRoomPath Rooms along the route, starting with InFromRoom and ending with InToRoom
+	 * @return False if there is no route
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room|Graph")
+	bool FindRoomPath(const ASVSRoom* InFromRoom, const ASVSRoom* InToRoom, TArray<ASVSRoom*>& OutRoomPath) const;
+	/**
+	 * @brief Collect rooms which can be reached from a room by passing through at most InMaxHops doors
+	 * @param OutRooms Rooms within range, including InFromRoom
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room|Graph")
+	void GetRoomsWithinHops(const ASVSRoom* InFromRoom, const int32 InMaxHops, TArray<ASVSRoom*>& OutRooms) const;
+	/**
+	 * @param InRoomIndex Room index of the source room
+	 * @return Hop count from the room to each room index, computed on first use and cached until a door on a route changes
+	 */
+	const TArray<uint16>& GetRoomDistanceRow(const int32 InRoomIndex) const;
+	int32 GetNumRooms() const { return RoomCollection.Num(); }
+
+	/**
+	 * @brief Authority only, pick a collision free respawn location in an unoccupied room
+	 * Rooms further from living opponents and recent deaths are preferred
+	 * @param InRespawningCharacter Character being respawned, not treated as an opponent
+	 * @param OutRespawnLocation Location for the character's capsule centre
+	 * @return False if no room has a valid spawn point
+	 */
+	bool FindRespawnLocation(const ASpyCharacter* InRespawningCharacter, FVector& OutRespawnLocation);
+	/** Authority only, remember a death so respawns avoid the area for a while */
+	void RecordSpyDeath(const FVector& InDeathLocation);
+
+	/** @return Number of actors in far away hidden rooms which are not ticking */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	int32 GetNumDormantRoomActors() const { return NumDormantRoomActors; }
+	/** Wake a dormant room right away, rooms about to be shown cannot wait for the next significance evaluation */
+	void WakeDormantRoom(const ASVSRoom* InRoom);
 
 private:
 
 	UPROPERTY()
 	TArray<FRoomListing> RoomCollection;
 
+#pragma region="RoomIndex"
+	/** Grid cells keyed by cell coordinate, each listing the RoomCollection indices of rooms overlapping the cell */
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> RoomGridIndex;
+	/** RoomCollection indices keyed by Room Guid */
+	TMap<FGuid, int32> RoomGuidIndex;
+	/** Size of a grid cell, derived from the smallest room so a cell only ever overlaps a handful of rooms */
+	float RoomGridCellSize = 0.0f;
+
+	/**
+	 * @brief Add a room listing to the collection
+	 * @return False if the room is invalid or already managed
+	 */
+	bool RegisterRoom(ASVSRoom* InRoom, const FGuid& InRoomGuid);
+	/** @return Index into RoomCollection of a managed room or INDEX_NONE */
+	int32 GetRoomListingIndex(const ASVSRoom* InRoom) const;
+	/** Recompute room bounds and rebuild grid and lookup maps from the Room Collection */
+	void RebuildRoomIndex();
+	/** Late registrations are batched into a single rebuild on the next tick */
+	bool bRoomIndexRebuildPending = false;
+	void RebuildPendingRoomIndex();
+	/** @return Index into RoomCollection of the room at the location or INDEX_NONE */
+	int32 FindRoomListingIndexAtLocation(const FVector& InLocation) const;
+	FIntPoint GetRoomGridCell(const FVector2D& InLocation) const;
+
+	/** Doors connecting managed rooms */
+	UPROPERTY()
+	TArray<FRoomDoorListing> RoomDoorCollection;
+	void CollectRoomDoors();
+#pragma endregion="RoomIndex"
+
+#pragma region="RoomGraph"
+	/** Compressed adjacency, neighbours of room i are RoomGraphNeighbours[RoomGraphOffsets[i]] to RoomGraphNeighbours[RoomGraphOffsets[i + 1] - 1] */
+	TArray<int32> RoomGraphOffsets;
+	TArray<int32> RoomGraphNeighbours;
+	/** RoomDoorCollection index of the door behind each entry in RoomGraphNeighbours */
+	TArray<int32> RoomGraphEdgeDoors;
+	/** Per source room index, hop count to each room index, empty until queried or once invalidated */
+	mutable TArray<TArray<uint16>> RoomDistanceRows;
+	mutable TArray<int32> RoomGraphSearchQueue;
+	
+	/** Build adjacency from RoomDoorCollection and clear cached distances */
+	void BuildRoomGraph();
+	/** Breadth first search from a room through traversable doors */
+	void ComputeRoomDistanceRow(const int32 InSourceRoomIndex) const;
+	/** Invalidate only the cached distances the door could have changed */
+	void OnRoomDoorTraversableChanged(const UDoorInteractionComponent* InDoorInteractionComponent, const bool bIsTraversable, const int32 InDoorIndex);
+#pragma endregion="RoomGraph"
+
+#pragma region="Respawn"
+	/** Spawn point candidates per room along each axis, validated against furniture when rooms are indexed */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn", meta = (ClampMin = "1", ClampMax = "8"))
+	uint8 SpawnPointsPerRoomAxis = 3;
+	/** Distance kept between spawn points and the room walls */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn", meta = (ClampMin = "0.0"))
+	float SpawnPointWallMargin = 100.0f;
+	/** Used when the game mode's default pawn has no capsule */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn")
+	FVector2D DefaultSpawnCapsuleSize = FVector2D(42.0f, 96.0f);
+	/** Opponents at least this many doors away are all considered equally far */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn", meta = (ClampMin = "1"))
+	int32 RespawnSafeHops = 3;
+	/** Deaths remembered when scoring respawn rooms */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn", meta = (ClampMin = "1"))
+	int32 RecentDeathHistorySize = 8;
+	/** Seconds for a death to stop affecting respawns */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn", meta = (ClampMin = "0.1"))
+	float RecentDeathDuration = 30.0f;
+	/** Score removed for a fresh death in the candidate room, halved one door away and so on */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn", meta = (ClampMin = "0.0"))
+	float RecentDeathWeight = 2.0f;
+	/** Random score added so equally safe rooms take turns */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Respawn", meta = (ClampMin = "0.0"))
+	float RespawnScoreJitter = 0.5f;
+
+	/** Spawn points of room i are RoomSpawnPoints[RoomSpawnPointOffsets[i]] to RoomSpawnPoints[RoomSpawnPointOffsets[i + 1] - 1] */
+	TArray<int32> RoomSpawnPointOffsets;
+	TArray<FVector> RoomSpawnPoints;
+	/** Ring buffer of recent deaths */
+	TArray<FRoomRecentDeath> RecentDeaths;
+	int32 RecentDeathCursor = 0;
+	
+	/** Sweep a character capsule through candidate points of each room and keep those clear of furniture */
+	void BuildRoomSpawnPoints();
+#pragma endregion="Respawn"
+
+#pragma region="OccupancyReplication"
+	/** One bit per room index */
+	UPROPERTY(ReplicatedUsing = OnRep_RoomOccupancyBits)
+	TArray<uint8> RoomOccupancyBits;
+	UFUNCTION()
+	void OnRep_RoomOccupancyBits();
+	/** Diff replicated occupancy bits against room listings and notify each changed room */
+	void ApplyRoomOccupancyBits();
+	/** Authority writes occupancy bits from room listings after rooms have been re-indexed */
+	void WriteRoomOccupancyBits();
+	static bool GetRoomOccupancyBit(const TArray<uint8>& InOccupancyBits, const int32 InRoomIndex);
+#pragma endregion="OccupancyReplication"
+
+#pragma region="OccupancyTracking"
+	/**
+	 * Opt-in replacement for room trigger overlaps, character locations are sampled against the room index
+	 * at a fixed rate and rooms are notified when a character changes room
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room")
+	bool bEnableOccupancyTracking = false;
+	/** Seconds between occupancy samples */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room", meta = (ClampMin = "0.01", EditCondition = "bEnableOccupancyTracking"))
+	float OccupancySampleInterval = 0.1f;
+	FTimerHandle OccupancySampleTimerHandle;
+	/** Room each character was found in during the last sample */
+	TMap<TWeakObjectPtr<ASpyCharacter>, TWeakObjectPtr<ASVSRoom>> TrackedCharacterRooms;
+	void SampleRoomOccupancy();
+#pragma endregion="OccupancyTracking"
+
+#pragma region="RoomTransition"
+	/** Custom Primitive Data or Material Parameter Collection, game modes pick a manager class per map */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room")
+	ERoomTransitionMode RoomTransitionMode = ERoomTransitionMode::CustomPrimitiveData;
+	/** Collection with one vector parameter per slot: Room ID, Visibility, Axis Direction, Axis */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room", meta = (EditCondition = "RoomTransitionMode == ERoomTransitionMode::ParameterCollection"))
+	UMaterialParameterCollection* RoomTransitionCollection;
+	/** Slot parameters are named with this prefix followed by the slot index, ex: RoomSlot0 */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room", meta = (EditCondition = "RoomTransitionMode == ERoomTransitionMode::ParameterCollection"))
+	FString RoomTransitionSlotPrefix = "RoomSlot";
+	/** Rooms which can animate at the same time, only a couple are needed by the local player */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "RoomTransitionMode == ERoomTransitionMode::ParameterCollection"))
+	uint8 RoomTransitionSlotCount = 4;
+	UPROPERTY()
+	UMaterialParameterCollectionInstance* RoomTransitionCollectionInstance;
+	TArray<FName> RoomTransitionSlotNames;
+	/** Room ID holding each slot, zero when free */
+	TArray<int32> RoomTransitionSlotOwners;
+	/** Resolve the collection instance and slot names, falls back to Custom Primitive Data if unavailable */
+	void InitRoomTransitionSlots();
+#pragma endregion="RoomTransition"
+
+#pragma region="RoomSignificance"
+	/**
+	 * Client only, hidden rooms further than this from every local player's room have their actors put to sleep:
+	 * no actor / component ticking, animation or audio
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Significance")
+	bool bEnableRoomSignificance = true;
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Significance", meta = (EditCondition = "bEnableRoomSignificance"))
+	float DormantRoomDistance = 3000.0f;
+	/** Dormant rooms wake once they come this much closer than DormantRoomDistance, avoids flip flopping at the edge */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Significance", meta = (ClampMin = "0.0", EditCondition = "bEnableRoomSignificance"))
+	float DormantRoomHysteresis = 1000.0f;
+	/** Seconds between significance evaluations */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room|Significance", meta = (ClampMin = "0.05", EditCondition = "bEnableRoomSignificance"))
+	float RoomSignificanceInterval = 0.5f;
+	FTimerHandle RoomSignificanceTimerHandle;
+	/** Per RoomCollection index, dormant actors of each room, empty when the room is awake */
+	TArray<TArray<FRoomDormantActor>> DormantRoomActors;
+	TBitArray<> DormantRooms;
+	/** Per RoomDoorCollection index, dormant door, doors sleep only when both rooms are dormant */
+	TArray<FRoomDormantActor> DormantDoors;
+	int32 NumDormantRoomActors = 0;
+	
+	void EvaluateRoomSignificance();
+	void SetRoomDormant(const int32 InRoomIndex, const bool bDormant);
+	static void PutActorToSleep(AActor* InActor, FRoomDormantActor& OutDormantActor);
+	static void WakeActor(FRoomDormantActor& InOutDormantActor);
+#pragma endregion="RoomSignificance"
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 };
@@ -31,6 +31,14 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "SVS|Furniture")
 	UInventoryComponent* GetInventoryComponent() const { return InventoryComponent; }
+	UFUNCTION(BlueprintCallable, Category = "SVS|Door")
+	UDoorInteractionComponent* GetDoorInteractionComponent() const { return DoorInteractionComponent; }
+
+	/** Prewarm the room on the other side of the door from the locally visible room */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Door")
+	void PrewarmAdjacentRooms() const;
+	/** @return True if the door connects the room to another */
+	bool IsDoorOfRoom(const ASVSRoom* InRoom) const;
 
 protected:
 
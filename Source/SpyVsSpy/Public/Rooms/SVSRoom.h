@@ -59,6 +59,32 @@ public:
 	}
 };
 
+/**
+ * Wall and floor components of a room cached once with the vanish effect values to apply to them
+ * All custom primitive data slots of a component are written together and only when they have changed
+ */
+USTRUCT()
+struct FVanishParameterBlock
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<UPrimitiveComponent*> Components;
+	/** Per component, whether it follows the appear timeline or stays hidden such as the camera facing walls */
+	TBitArray<> ComponentFollowsVisibility;
+	/** Per component, the slot values last sent to the renderer */
+	TArray<TOptional<FVector>> ComponentWrittenValues;
+
+	/** Slot 0 */
+	float Visibility = 0.0f;
+	/** Slot 1 */
+	float AxisDirection = 0.0f;
+	/** Slot 2 */
+	float Axis = 0.0f;
+	bool bDirty = false;
+};
+
 /** Begin Delegates */
 /**
  * Notify listeners such as Doors and Furniture that the occupancy status of the room has changed
@@ -83,6 +109,7 @@ public:
 	
 	/** Class Overrides */
 	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
 // #if WITH_EDITOR
 // 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -125,10 +152,53 @@ public:
 	ARoomManager* RoomManager;
 	UFUNCTION(BlueprintCallable)
 	FGuid GetRoomGuid() const { return RoomGuid; }
+	/** Room index not yet assigned by the Room Manager */
+	static constexpr uint16 InvalidRoomIndex = MAX_uint16;
+	/** @return Compact room handle shared by server and clients, use it to reference the room in RPCs and replicated state */
+	uint16 GetRoomIndex() const { return RoomIndex; }
 
 	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
 	bool IsFinalMissionRoom() const { return bIsFinalMissionRoom; }
 
+	/**
+	 * @brief Handle a Spy Character entering or leaving the room
+	 * Called by the Room Trigger overlaps or by the Room Manager when it tracks occupancy
+	 * @param SpyCharacter Character entering or leaving
+	 */
+	void NotifySpyCharacterEntered(ASpyCharacter* SpyCharacter);
+	void NotifySpyCharacterExited(ASpyCharacter* SpyCharacter);
+
+	/**
+	 * @brief Enable or disable the Room Trigger, disabled when the Room Manager tracks occupancy instead
+	 * @param bEnabled Should the Room Trigger generate overlaps
+	 */
+	void SetOccupancyTriggerEnabled(const bool bEnabled);
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	bool IsOccupancyTriggerEnabled() const { return bOccupancyTriggerEnabled; }
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	int32 GetNumOccupyingSpyCharacters() const { return OccupyingSpyCharacters.Num(); }
+
+	/**
+	 * @brief Assign the room index and bake the ID used to match the room's materials with a Room Transition Collection slot
+	 * @param InRoomIndex Room index assigned by the Room Manager
+	 */
+	void SetRoomIndex(const uint16 InRoomIndex);
+
+	/**
+	 * @brief Prepare a hidden room to be revealed, ex: when the local player approaches or opens a door into it
+	 * Render proxies are created while the room is still invisible and textures are streamed in
+	 * so the reveal on entry is only a parameter change
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	void PrewarmRoom();
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	bool IsRoomPrewarmed() const { return bRoomPrewarmed; }
+	/** Appends the room and the furniture within it */
+	void GetRoomActors(TArray<AActor*>& OutRoomActors);
+	/** @return True while the appear / vanish effect is playing */
+	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
+	bool IsRoomTransitioning() const;
+
 protected:
 	
 	UPROPERTY(BlueprintReadWrite, EditInstanceOnly, Category = "SVS|Room")
@@ -136,8 +206,10 @@ protected:
 	
 private:
 
-	/** Unique Room Identifier used by Room Manager */
+	/** Unique Room Identifier used by Room Manager, derived from the room's level name so it is the same on server and clients */
 	FGuid RoomGuid;
+	/** Position of the room in the Room Manager's room collection */
+	uint16 RoomIndex = InvalidRoomIndex;
 
 	UPROPERTY(EditInstanceOnly, Category = "SVS|Room")
 	bool bRoomLocallyHiddenInGame = true;
@@ -159,6 +231,44 @@ private:
 	UFUNCTION(BlueprintCallable, Category = "SVS|Room")
 	FVanishPrimitiveData SetRoomTraversalDirection(const ASpyCharacter* PlayerCharacter, const bool bIsEntering) const;
 
+	/** Room Prewarm */
+	bool bRoomPrewarmed = false;
+	/** Seconds a prewarmed room waits to be entered before it is hidden again */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room")
+	float PrewarmTimeout = 5.0f;
+	/** Seconds to force texture streaming for a prewarmed room and its furniture */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room")
+	float PrewarmTextureStreamDuration = 3.0f;
+	FTimerHandle PrewarmTimeoutTimerHandle;
+	/** Return a prewarmed room which was not entered to its hidden state */
+	void ReleasePrewarm();
+	/** Local views skip furniture in this list while still keeping their render proxies */
+	void SetFurnitureHiddenFromLocalViews(const bool bHiddenFromLocalViews) const;
+
+	/** Cached components and values for the vanish effect */
+	UPROPERTY()
+	FVanishParameterBlock VanishParameterBlock;
+	/** Collect wall and floor components once so effect updates do not have to query the room */
+	void CacheVanishParameterBlock();
+	void SetVanishVisibility(const float InVisibility);
+	void SetVanishTraversal(const FVanishPrimitiveData& InVanishPrimitiveData);
+	/** Write pending vanish values, one custom primitive data update per changed component */
+	void FlushVanishParameterBlock();
+
+	/** Room Transition Collection, see ARoomManager::RoomTransitionMode */
+	/** Custom Primitive Data index of the Room ID, after the vanish effect slots */
+	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room")
+	int32 RoomTransitionIdDataIndex = 4;
+	/** Room index plus one, zero is reserved for components which never match a transition slot */
+	int32 RoomTransitionId = 0;
+	/** Collection slot held while the room animates, otherwise the vanish effect uses Custom Primitive Data */
+	int32 RoomTransitionSlot = INDEX_NONE;
+	void BakeRoomTransitionId();
+	/** Reserve a collection slot for the coming transition if the Room Manager uses the collection */
+	void AcquireRoomTransitionSlot();
+	/** Free the collection slot and settle the final effect values into Custom Primitive Data */
+	void ReleaseRoomTransitionSlot();
+
 	/** Timeline components for fade in / out effects */
 	/** Appear */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta = (AllowPrivateAccess = "true"), Category = "SVS|Room")
@@ -166,7 +276,7 @@ private:
 	FOnTimelineFloat OnAppearTimelineUpdate;
 	FOnTimelineEvent OnAppearTimelineFinish;
 	UFUNCTION()
-	void TimelineAppearUpdate(float const VisibilityInterp) const;
+	void TimelineAppearUpdate(float const VisibilityInterp);
 	UFUNCTION()
 	void TimelineAppearFinish();
 
@@ -177,6 +287,7 @@ private:
 	float RoomTriggerScaleMargin = 10.0f;
 	UPROPERTY(EditDefaultsOnly, Category = "SVS|Room")
 	float RoomTriggerHeight = 200.0f;
+	bool bOccupancyTriggerEnabled = true;
 	UFUNCTION()
 	void OnOverlapBegin(AActor* OverlappedActor, AActor* OtherActor);
 	UFUNCTION()
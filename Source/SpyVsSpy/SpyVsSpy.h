@@ -3,11 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
 
 #define COLLISION_INTERACT			ECollisionChannel::ECC_GameTraceChannel1
 #define PROJECT_PATH				"/Script/SpyVsSpy"
 #define ABILITY_INPUT_ID			"ESpyAbilityInputID"
 
+DECLARE_STATS_GROUP(TEXT("SpyVsSpy"), STATGROUP_SpyVsSpy, STATCAT_Advanced);
+
 
 UENUM(BlueprintType)
 enum class ESpyAbilityInputID : uint8
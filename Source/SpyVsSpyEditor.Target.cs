@@ -10,6 +10,6 @@ public class SpyVsSpyEditorTarget : TargetRules
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V2;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_1;
-		ExtraModuleNames.Add("SpyVsSpy");
+		ExtraModuleNames.AddRange(new string[] { "SpyVsSpy", "SpyVsSpyEditor" });
 	}
 }
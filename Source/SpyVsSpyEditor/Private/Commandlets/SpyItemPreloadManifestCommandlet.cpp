@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Commandlets/SpyItemPreloadManifestCommandlet.h"
+
+#include "SpyVsSpyEditor.h"
+#include "GameModes/SpyItemPreloadManifest.h"
+#include "GameModes/SpyItemWorldSubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/LevelScriptBlueprint.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_MakeArray.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+USpyItemPreloadManifestCommandlet::USpyItemPreloadManifestCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USpyItemPreloadManifestCommandlet::Main(const FString& Params)
+{
+	FString MapPath = TEXT("/Game/SvS");
+	FParse::Value(*Params, TEXT("MapPath="), MapPath);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter MapFilter;
+	MapFilter.ClassPaths.Emplace(UWorld::StaticClass()->GetClassPathName());
+	MapFilter.PackagePaths.Emplace(*MapPath);
+	MapFilter.bRecursivePaths = true;
+	TArray<FAssetData> MapAssets;
+	AssetRegistry.GetAssets(MapFilter, MapAssets);
+
+	const UFunction* LoadSpyItemAssetsFunction = USpyItemWorldSubsystem::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(USpyItemWorldSubsystem, LoadSpyItemAssets));
+	check(LoadSpyItemAssetsFunction);
+	
+	USpyItemPreloadManifest* PreloadManifest = GetMutableDefault<USpyItemPreloadManifest>();
+	PreloadManifest->MapItemManifests.Reset();
+
+	for (const FAssetData& MapAsset : MapAssets)
+	{
+		const UWorld* MapWorld = Cast<UWorld>(MapAsset.GetAsset());
+		ULevelScriptBlueprint* LevelScriptBlueprint = IsValid(MapWorld) && IsValid(MapWorld->PersistentLevel) ?
+			MapWorld->PersistentLevel->GetLevelScriptBlueprint(/*bDontCreate=*/ true) : nullptr;
+		if (!IsValid(LevelScriptBlueprint))
+		{ continue; }
+
+		FSpyItemPreloadMapEntry MapEntry;
+		MapEntry.MapPackageName = MapAsset.PackageName;
+
+		TArray<UK2Node_CallFunction*> CallFunctionNodes;
+		FBlueprintEditorUtils::GetAllNodesOfClass(LevelScriptBlueprint, CallFunctionNodes);
+		for (const UK2Node_CallFunction* CallFunctionNode : CallFunctionNodes)
+		{
+			if (CallFunctionNode->GetTargetFunction() != LoadSpyItemAssetsFunction)
+			{ continue; }
+
+			/** Only ids which are literals in a Make Array node can be known before the map runs */
+			const UEdGraphPin* ItemAssetIdsPin = CallFunctionNode->FindPin(TEXT("InItemAssetIdContainer"));
+			const UK2Node_MakeArray* MakeArrayNode = ItemAssetIdsPin && ItemAssetIdsPin->LinkedTo.Num() == 1 ?
+				Cast<UK2Node_MakeArray>(ItemAssetIdsPin->LinkedTo[0]->GetOwningNode()) : nullptr;
+			if (!IsValid(MakeArrayNode))
+			{
+				UE_LOG(SVSEditorLog, Warning, TEXT("SpyItemPreloadManifest could not resolve item ids of a LoadSpyItemAssets call in map: %s"),
+					*MapAsset.PackageName.ToString());
+				continue;
+			}
+
+			for (const UEdGraphPin* ItemAssetIdPin : MakeArrayNode->Pins)
+			{
+				if (ItemAssetIdPin->Direction != EGPD_Input || ItemAssetIdPin->LinkedTo.Num() > 0)
+				{ continue; }
+
+				FPrimaryAssetId ItemAssetId;
+				TBaseStructure<FPrimaryAssetId>::Get()->ImportText(
+					*ItemAssetIdPin->DefaultValue,
+					&ItemAssetId,
+					nullptr,
+					PPF_None,
+					GLog,
+					TEXT("PrimaryAssetId"));
+				if (ItemAssetId.IsValid())
+				{ MapEntry.ItemAssetIds.AddUnique(ItemAssetId); }
+			}
+		}
+
+		if (MapEntry.ItemAssetIds.Num() == 0)
+		{ continue; }
+
+		UE_LOG(SVSEditorLog, Display, TEXT("SpyItemPreloadManifest map: %s has %i items"),
+			*MapAsset.PackageName.ToString(),
+			MapEntry.ItemAssetIds.Num());
+		PreloadManifest->MapItemManifests.Emplace(MapEntry);
+	}
+
+	if (!PreloadManifest->TryUpdateDefaultConfigFile())
+	{
+		UE_LOG(SVSEditorLog, Error, TEXT("SpyItemPreloadManifest could not write the manifest to the default config file"));
+		return 1;
+	}
+	return 0;
+}
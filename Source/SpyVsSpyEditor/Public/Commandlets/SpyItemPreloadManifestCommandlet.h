@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SpyItemPreloadManifestCommandlet.generated.h"
+
+/**
+ * Scans the level blueprint of each map for LoadSpyItemAssets calls and writes the requested
+ * item ids to the SpyItemPreloadManifest in DefaultGame.ini.
+ * Run before cooking: UnrealEditor-Cmd SpyVsSpy.uproject -run=SpyItemPreloadManifest [-MapPath=/Game/SvS]
+ */
+UCLASS()
+class SPYVSSPYEDITOR_API USpyItemPreloadManifestCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	USpyItemPreloadManifestCommandlet();
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class SpyVsSpyEditor : ModuleRules
+{
+	public SpyVsSpyEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"SpyVsSpy"
+		});
+
+		/** Item preload manifest commandlet reads level blueprints */
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"AssetRegistry",
+			"BlueprintGraph",
+			"UnrealEd"
+		});
+	}
+}
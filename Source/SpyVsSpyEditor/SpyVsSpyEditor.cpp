@@ -0,0 +1,8 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SpyVsSpyEditor.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(SVSEditorLog);
+
+IMPLEMENT_MODULE( FDefaultModuleImpl, SpyVsSpyEditor );